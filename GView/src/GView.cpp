@@ -1,5 +1,10 @@
 #include "../GViewCore/include/GView.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 enum class CommandID
 {
@@ -8,7 +13,9 @@ enum class CommandID
     Open,
     Reset,
     ListTypes,
-    UpdateConfig
+    UpdateConfig,
+    Identify,
+    Analyze
 };
 
 struct CommandInfo
@@ -37,6 +44,8 @@ CommandInfo commands[] = {
     { CommandID::Reset, _U("reset") },
     { CommandID::ListTypes, _U("list-types") },
     { CommandID::UpdateConfig, _U("updateconfig") },
+    { CommandID::Identify, _U("identify") },
+    { CommandID::Analyze, _U("analyze") },
 };
 
 std::string_view help = R"HELP(
@@ -61,11 +70,28 @@ Where <command> is on of:
 
    list-types             List all available types (as loaded from gview.ini).
                           Ex: 'GView list-types' 
+
+   identify [fileName|path]
+                          Prints the type of one or multiple files (folders
+                          are scanned recursively) without opening any
+                          window. One line is printed for each file (in the
+                          order the files are processed).
+                          Ex: 'GView identify samples --jobs 8 --json'
+
+   analyze [fileName|path]
+                          Same as 'identify', but the type plugin also parses
+                          each file and a JSON object with the parsed model
+                          (headers, sections, imports, symbols, streams, ...)
+                          is printed for each file (one object per line).
+                          Ex: 'GView analyze samples --jobs 8'
 And <options> are:
    --type:<type>          Specify the type of the file (if knwon)
                           Ex: 'GView open a.temp --type:PE'    
    --selectType           Specify the type of the file should be manually selected
                           Ex: 'GView open a.temp --selectType'   
+   --jobs <count>         Number of threads used by 'identify' and 'analyze'
+                          (defaults to the number of processors)
+   --json                 'identify' prints a JSON object for each file
 )HELP";
 
 void ShowHelp()
@@ -157,6 +183,187 @@ int ProcessOpenCommand(int argc, T** argv, int startIndex)
     return 0;
 }
 
+class IdentifyQueue
+{
+    std::deque<std::filesystem::path> files;
+    std::mutex lock;
+    std::condition_variable notEmpty, notFull;
+    size_t maxSize;
+    bool finished;
+
+  public:
+    IdentifyQueue(size_t size) : maxSize(size), finished(false)
+    {
+    }
+    // blocks while the queue is full (so that large folders are not enumerated in memory)
+    void Push(std::filesystem::path path)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        notFull.wait(guard, [this]() { return files.size() < maxSize; });
+        files.push_back(std::move(path));
+        notEmpty.notify_one();
+    }
+    bool Pop(std::filesystem::path& path)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        notEmpty.wait(guard, [this]() { return finished || !files.empty(); });
+        if (files.empty())
+            return false;
+        path = std::move(files.front());
+        files.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+    void Finish()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        finished = true;
+        notEmpty.notify_all();
+    }
+};
+
+std::string PathToUTF8(const std::filesystem::path& path)
+{
+    auto u8 = path.u8string();
+    return std::string(reinterpret_cast<const char*>(u8.data()), u8.size());
+}
+
+// 'identify' and 'analyze' commands (the files are processed in parallel by a pool of workers)
+template <typename T>
+int ProcessBatchCommand(int argc, T** argv, int startIndex, bool analyze)
+{
+    LocalString<128> tempString;
+    auto jobs = std::max<>(std::thread::hardware_concurrency(), 1U);
+    auto json = analyze; // analyze always prints JSON
+    std::vector<std::filesystem::path> paths;
+
+    for (auto index = startIndex; index < argc; index++)
+    {
+        if (argv[index][0] != '-')
+        {
+            paths.emplace_back(argv[index]);
+            continue;
+        }
+        // options are always in ASCII format
+        tempString.Clear();
+        for (const T* p = argv[index]; *p; p++)
+            tempString.AddChar(static_cast<char>(*p));
+        if (tempString.Equals("--json", true))
+        {
+            json = true;
+            continue;
+        }
+        if ((tempString.Equals("--jobs", true)) && (index + 1 < argc))
+        {
+            index++;
+            tempString.Clear();
+            for (const T* p = argv[index]; *p; p++)
+                tempString.AddChar(static_cast<char>(*p));
+            auto value = Number::ToUInt32(tempString.ToStringView());
+            if ((value.has_value()) && (value.value() > 0) && (value.value() <= 256))
+            {
+                jobs = value.value();
+                continue;
+            }
+            std::cout << "Invalid number of jobs: " << tempString.ToStringView() << " (expecting a value between 1 and 256)" << std::endl;
+            return 1;
+        }
+        std::cout << "Unknwon option: " << tempString.ToStringView() << std::endl;
+        std::cout << "Type 'GView help' for a detailed list of available options" << std::endl;
+        return 1;
+    }
+    if (paths.empty())
+    {
+        std::cout << "Expecting at least one file or folder to " << (analyze ? "analyze" : "identify") << std::endl;
+        return 1;
+    }
+    CHECK(GView::App::InitHeadless(), 1, "");
+
+    IdentifyQueue queue(static_cast<size_t>(jobs) * 64);
+    std::mutex outputLock;
+    uint64 filesCount = 0, errorsCount = 0;
+    const auto startTime = std::chrono::steady_clock::now();
+
+    auto worker = [&]()
+    {
+        std::filesystem::path path;
+        std::string line;
+        GView::Utils::JSONWriter output;
+        while (queue.Pop(path))
+        {
+            std::string_view typeName;
+            auto ok = false;
+            line.clear();
+            if (analyze)
+            {
+                ok = GView::App::AnalyzeFile(path, output);
+                line += output.GetText();
+            }
+            else
+            {
+                ok = GView::App::IdentifyFile(path, typeName);
+                if (json)
+                {
+                    output.Clear();
+                    output.BeginObject();
+                    output.AddString("path", std::u16string_view(path.u16string()));
+                    if (!ok)
+                        output.AddString("error", "unable to read the file");
+                    else if (typeName.empty())
+                        output.AddNull("type");
+                    else
+                        output.AddString("type", typeName);
+                    output.EndObject();
+                    line += output.GetText();
+                }
+                else
+                {
+                    line += PathToUTF8(path);
+                    line += ": ";
+                    line += ok ? (typeName.empty() ? "unknown" : typeName) : "error (unable to read the file)";
+                }
+            }
+            line += '\n';
+
+            std::lock_guard<std::mutex> guard(outputLock);
+            std::cout << line;
+            filesCount++;
+            errorsCount += ok ? 0 : 1;
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(jobs);
+    for (auto index = 0U; index < jobs; index++)
+        workers.emplace_back(worker);
+
+    // enumerate the files (folders are scanned recursively) while the workers identify them
+    for (auto& path : paths)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(path, ec))
+        {
+            queue.Push(path);
+            continue;
+        }
+        auto it = std::filesystem::recursive_directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec);
+        for (; (!ec) && (it != std::filesystem::recursive_directory_iterator()); it.increment(ec))
+        {
+            if (it->is_regular_file(ec))
+                queue.Push(it->path());
+        }
+        if (ec)
+            std::cerr << "Fail to enumerate: " << PathToUTF8(path) << " (" << ec.message() << ")" << std::endl;
+    }
+    queue.Finish();
+    for (auto& w : workers)
+        w.join();
+
+    std::cout.flush();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    std::cerr << (analyze ? "Analyzed " : "Identified ") << filesCount << " files (" << errorsCount << " errors) in " << elapsed << " ms using " << jobs << " threads" << std::endl;
+    return errorsCount > 0 ? 2 : 0;
+}
+
 #ifdef BUILD_FOR_WINDOWS
 int wmain(int argc, const wchar_t** argv)
 #else
@@ -183,6 +390,10 @@ int main(int argc, const char** argv)
         return 0;
     case CommandID::Open:
         return ProcessOpenCommand(argc, argv, 2);
+    case CommandID::Identify:
+        return ProcessBatchCommand(argc, argv, 2, false);
+    case CommandID::Analyze:
+        return ProcessBatchCommand(argc, argv, 2, true);
     case CommandID::Unknown:
         return ProcessOpenCommand(argc, argv, 1);
     default:
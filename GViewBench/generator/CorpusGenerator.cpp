@@ -0,0 +1,301 @@
+// Generates the synthetic corpora used by GViewBench.
+// The output only depends on the fixed seeds below => every build produces the same files (results can be compared between commits).
+#include "Generator.hpp"
+
+#include <zlib.h>
+#include <cstdio>
+#include <fstream>
+
+constexpr size_t RANDOM_SIZE   = 16 * 1024 * 1024;
+constexpr size_t BINARY_SIZE   = 16 * 1024 * 1024;
+constexpr size_t TEXT_SIZE     = 8 * 1024 * 1024;
+constexpr size_t UNICODE_SIZE  = 4 * 1024 * 1024;
+constexpr size_t BASE64_SIZE   = 6 * 1024 * 1024;
+constexpr size_t XPRESS_SIZE   = 4 * 1024 * 1024;
+constexpr size_t XPRESS_CHUNK  = 0x10000;
+
+bool Write(const std::filesystem::path& folder, std::string_view name, const Bytes& content)
+{
+    std::ofstream out(folder / name, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        fprintf(stderr, "Fail to create: %s\n", (folder / name).string().c_str());
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+    return static_cast<bool>(out);
+}
+
+Bytes CreateRandom(size_t size, uint64_t seed)
+{
+    Random rnd(seed);
+    Bytes result(size);
+    for (size_t index = 0; index + 8 <= size; index += 8) {
+        auto value = rnd.Next();
+        for (auto b = 0; b < 8; b++)
+            result[index + b] = static_cast<uint8_t>(value >> (b * 8));
+    }
+    return result;
+}
+
+// executable-like content: zero padding, small integers, pointers, strings and random (packed) data
+Bytes CreateBinary(size_t size, uint64_t seed)
+{
+    Random rnd(seed);
+    Bytes result;
+    result.reserve(size);
+    while (result.size() < size) {
+        auto length = 64 + rnd.Next(4096);
+        switch (rnd.Next(5)) {
+        case 0:
+            result.insert(result.end(), length, 0);
+            break;
+        case 1:
+            for (auto index = 0U; index < length; index++)
+                result.push_back(static_cast<uint8_t>(rnd.Next(16)));
+            break;
+        case 2:
+            for (auto index = 0U; index < length; index += 8) {
+                uint64_t pointer = 0x140000000ULL + rnd.Next(0x100000) * 8;
+                for (auto b = 0; b < 8; b++)
+                    result.push_back(static_cast<uint8_t>(pointer >> (b * 8)));
+            }
+            break;
+        case 3:
+            for (auto index = 0U; index < length; index++)
+                result.push_back(static_cast<uint8_t>(rnd.Next(10) == 0 ? 0 : 'a' + rnd.Next(26)));
+            break;
+        default:
+            for (auto index = 0U; index < length; index++)
+                result.push_back(static_cast<uint8_t>(rnd.Next()));
+            break;
+        }
+    }
+    result.resize(size);
+    return result;
+}
+
+Bytes CreateText(size_t size, uint64_t seed)
+{
+    static const std::string_view words[] = { "the",     "file",   "offset", "section", "header", "buffer", "value",  "GView",    "parser", "cache",
+                                              "zone",    "window", "plugin", "type",    "import", "export", "symbol", "resource", "string", "stream",
+                                              "entropy", "hash",   "table",  "data",    "code",   "view",   "size",   "address",  "name",   "object" };
+    Random rnd(seed);
+    Bytes result;
+    result.reserve(size + 64);
+    auto lineLength = 0U;
+    while (result.size() < size) {
+        auto word = words[rnd.Next(static_cast<uint32_t>(std::size(words)))];
+        result.insert(result.end(), word.begin(), word.end());
+        lineLength += static_cast<uint32_t>(word.size()) + 1;
+        if (rnd.Next(16) == 0) {
+            auto number = std::to_string(rnd.Next(100000));
+            result.push_back(' ');
+            result.insert(result.end(), number.begin(), number.end());
+        }
+        if (lineLength > 60 + rnd.Next(40)) {
+            result.push_back('\n');
+            lineLength = 0;
+        } else {
+            result.push_back(' ');
+        }
+    }
+    result.resize(size);
+    return result;
+}
+
+// mostly ASCII text with some 2 and 3 bytes UTF-8 characters (no BOM)
+Bytes CreateUTF8(size_t size, uint64_t seed)
+{
+    Random rnd(seed);
+    auto text = CreateText(size, seed + 1);
+    Bytes result;
+    result.reserve(size + 16);
+    for (auto ch : text) {
+        if (result.size() + 3 > size)
+            break;
+        if ((ch == ' ') && (rnd.Next(8) == 0)) {
+            const uint32_t value = rnd.Next(2) ? 0xE9 /* é */ : 0x20AC /* € */;
+            if (value < 0x800) {
+                result.push_back(static_cast<uint8_t>(0xC0 | (value >> 6)));
+                result.push_back(static_cast<uint8_t>(0x80 | (value & 0x3F)));
+            } else {
+                result.push_back(static_cast<uint8_t>(0xE0 | (value >> 12)));
+                result.push_back(static_cast<uint8_t>(0x80 | ((value >> 6) & 0x3F)));
+                result.push_back(static_cast<uint8_t>(0x80 | (value & 0x3F)));
+            }
+            continue;
+        }
+        result.push_back(ch);
+    }
+    return result;
+}
+
+// UTF-16 (little endian) text with BOM
+Bytes CreateUTF16(size_t size, uint64_t seed)
+{
+    auto text = CreateText(size / 2 - 1, seed);
+    Bytes result;
+    result.reserve(size);
+    result.push_back(0xFF);
+    result.push_back(0xFE);
+    for (auto ch : text) {
+        result.push_back(ch);
+        result.push_back(0);
+    }
+    return result;
+}
+
+Bytes CreateBase64(const Bytes& content)
+{
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    Bytes result;
+    result.reserve(content.size() * 4 / 3 + content.size() / 38 + 8);
+    auto lineLength = 0U;
+    for (size_t index = 0; index < content.size(); index += 3) {
+        uint32_t value = static_cast<uint32_t>(content[index]) << 16;
+        if (index + 1 < content.size())
+            value |= static_cast<uint32_t>(content[index + 1]) << 8;
+        if (index + 2 < content.size())
+            value |= content[index + 2];
+        result.push_back(table[(value >> 18) & 0x3F]);
+        result.push_back(table[(value >> 12) & 0x3F]);
+        result.push_back(index + 1 < content.size() ? table[(value >> 6) & 0x3F] : '=');
+        result.push_back(index + 2 < content.size() ? table[value & 0x3F] : '=');
+        lineLength += 4;
+        if (lineLength == 76) {
+            result.push_back('\r');
+            result.push_back('\n');
+            lineLength = 0;
+        }
+    }
+    return result;
+}
+
+bool CreateZLIB(const Bytes& content, Bytes& result)
+{
+    auto size = compressBound(static_cast<uLong>(content.size()));
+    result.resize(size);
+    if (compress2(result.data(), &size, content.data(), static_cast<uLong>(content.size()), Z_DEFAULT_COMPRESSION) != Z_OK)
+        return false;
+    result.resize(size);
+    return true;
+}
+
+// LZXPRESS Huffman (MS-XCA 2.2) stream that only uses literals: symbols 0..254 have 8 bits codes, symbol 255 and
+// the end of stream symbol (256) have 9 bits codes. The input is split in chunks of 64K, each one with its own table.
+class XpressWriter
+{
+    Bytes& output;
+    size_t wordOffset[2];
+    uint32_t bits, bitsCount, pending;
+
+    void ReserveWord()
+    {
+        wordOffset[pending++] = output.size();
+        output.push_back(0);
+        output.push_back(0);
+    }
+    void FlushWord(uint16_t value)
+    {
+        output[wordOffset[0]]     = static_cast<uint8_t>(value);
+        output[wordOffset[0] + 1] = static_cast<uint8_t>(value >> 8);
+        wordOffset[0]             = wordOffset[1];
+        pending--;
+    }
+
+  public:
+    explicit XpressWriter(Bytes& out) : output(out), wordOffset{ 0, 0 }, bits(0), bitsCount(0), pending(0)
+    {
+    }
+    void Begin()
+    {
+        bits      = 0;
+        bitsCount = 0;
+        pending   = 0;
+        ReserveWord();
+        ReserveWord();
+    }
+    void AddBits(uint32_t code, uint32_t count)
+    {
+        bits = (bits << count) | code;
+        bitsCount += count;
+        while (bitsCount >= 16) {
+            bitsCount -= 16;
+            FlushWord(static_cast<uint16_t>(bits >> bitsCount));
+            ReserveWord();
+        }
+    }
+    void End()
+    {
+        // the decoder starts with 32 bits and reads a new word only when less than 16 bits are left => the next table
+        // starts right after the last word that it has read (the look-ahead word is not written if the bits end on a
+        // word boundary)
+        if (bitsCount > 0) {
+            FlushWord(static_cast<uint16_t>(bits << (16 - bitsCount)));
+        } else {
+            output.resize(output.size() - 2);
+            pending--;
+        }
+        while (pending > 0)
+            FlushWord(0);
+    }
+};
+
+Bytes CreateXpress(const Bytes& content)
+{
+    Bytes result;
+    result.reserve(content.size() + content.size() / 64 + 1024);
+    XpressWriter writer(result);
+    for (size_t start = 0; start < content.size(); start += XPRESS_CHUNK) {
+        // table: 4 bits per symbol (512 symbols), low nibble first
+        for (auto symbol = 0U; symbol < 512; symbol += 2) {
+            uint8_t low  = symbol < 255 ? 8 : (symbol <= 256 ? 9 : 0);
+            uint8_t high = symbol + 1 < 255 ? 8 : (symbol + 1 <= 256 ? 9 : 0);
+            result.push_back(static_cast<uint8_t>(low | (high << 4)));
+        }
+        writer.Begin();
+        const auto end = std::min<size_t>(start + XPRESS_CHUNK, content.size());
+        for (auto index = start; index < end; index++) {
+            if (content[index] < 255)
+                writer.AddBits(content[index], 8);
+            else
+                writer.AddBits(510, 9);
+        }
+        if (end == content.size())
+            writer.AddBits(511, 9); // end of stream
+        writer.End();
+    }
+    return result;
+}
+
+int main(int argc, const char** argv)
+{
+    if (argc != 2) {
+        fprintf(stderr, "Use: GViewBenchCorpus <output folder>\n");
+        return 1;
+    }
+    std::filesystem::path folder(argv[1]);
+    std::error_code ec;
+    std::filesystem::create_directories(folder, ec);
+
+    const auto random = CreateRandom(RANDOM_SIZE, 0x5EED0001);
+    const auto text   = CreateText(TEXT_SIZE, 0x5EED0002);
+    Bytes zlib;
+    if (!CreateZLIB(text, zlib)) {
+        fprintf(stderr, "Fail to compress the text corpus\n");
+        return 1;
+    }
+    const Bytes xpressInput(text.begin(), text.begin() + XPRESS_SIZE);
+    const Bytes base64Input(random.begin(), random.begin() + BASE64_SIZE);
+
+    auto ok = Write(folder, "random.bin", random);
+    ok      = ok && Write(folder, "binary.bin", CreateBinary(BINARY_SIZE, 0x5EED0003));
+    ok      = ok && Write(folder, "text.txt", text);
+    ok      = ok && Write(folder, "utf8.txt", CreateUTF8(UNICODE_SIZE, 0x5EED0004));
+    ok      = ok && Write(folder, "utf16.txt", CreateUTF16(UNICODE_SIZE, 0x5EED0005));
+    ok      = ok && Write(folder, "base64.txt", CreateBase64(base64Input));
+    ok      = ok && Write(folder, "text.zlib", zlib);
+    ok      = ok && Write(folder, "text.xpress", CreateXpress(xpressInput));
+    ok      = ok && CreateTypes(folder / "types");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Bytes = std::vector<uint8_t>;
+
+class Random
+{
+    uint64_t state;
+
+  public:
+    explicit Random(uint64_t seed) : state(seed)
+    {
+    }
+    // splitmix64
+    uint64_t Next()
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    uint32_t Next(uint32_t limit)
+    {
+        return static_cast<uint32_t>(Next() % limit);
+    }
+};
+
+bool Write(const std::filesystem::path& folder, std::string_view name, const Bytes& content);
+
+// inputs for the type plugins (PE, ELF, PCAP, ZIP, CSV, JS, ISO) - each one with a growing number of items
+bool CreateTypes(const std::filesystem::path& folder);
@@ -0,0 +1,720 @@
+// Synthetic inputs for the type plugins. Every format is generated with 100, 1000 and 10000 items (sections/imports/resources,
+// symbols, packets, entries, rows, statements, directories) so that the parse time and the memory can be plotted against N.
+// The structures are written field by field (little endian) => the generator does not depend on the plugin headers.
+#include "Generator.hpp"
+
+#include <zlib.h>
+#include <algorithm>
+#include <cstdio>
+
+constexpr uint32_t ITEMS[] = { 100, 1000, 10000 };
+
+namespace
+{
+void Put8(Bytes& out, uint32_t value)
+{
+    out.push_back(static_cast<uint8_t>(value));
+}
+void Put16(Bytes& out, uint32_t value)
+{
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+void Put32(Bytes& out, uint32_t value)
+{
+    for (auto b = 0; b < 32; b += 8)
+        out.push_back(static_cast<uint8_t>(value >> b));
+}
+void Put64(Bytes& out, uint64_t value)
+{
+    for (auto b = 0; b < 64; b += 8)
+        out.push_back(static_cast<uint8_t>(value >> b));
+}
+void Put16BE(Bytes& out, uint32_t value)
+{
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+void Put32BE(Bytes& out, uint32_t value)
+{
+    for (auto b = 24; b >= 0; b -= 8)
+        out.push_back(static_cast<uint8_t>(value >> b));
+}
+void PutText(Bytes& out, std::string_view text)
+{
+    out.insert(out.end(), text.begin(), text.end());
+}
+// fixed size field padded with "fill"
+void PutText(Bytes& out, std::string_view text, size_t size, uint8_t fill)
+{
+    for (size_t index = 0; index < size; index++)
+        out.push_back(index < text.size() ? static_cast<uint8_t>(text[index]) : fill);
+}
+void Set32(Bytes& out, size_t offset, uint32_t value)
+{
+    for (auto b = 0; b < 4; b++)
+        out[offset + b] = static_cast<uint8_t>(value >> (b * 8));
+}
+void Align(Bytes& out, size_t alignment)
+{
+    out.resize((out.size() + alignment - 1) / alignment * alignment);
+}
+uint32_t AlignValue(uint32_t value, uint32_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+std::string Name(std::string_view prefix, uint32_t index, uint32_t digits = 5)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%0*u", static_cast<int>(digits), index);
+    return std::string(prefix) + buffer;
+}
+
+// PE32 executable: min(N, 96) sections (the limit of the Windows loader), N imported functions (100 per DLL, some of them
+// with C++ decorated names) and N RCDATA resources (at most 1000 for each type)
+Bytes CreatePE(uint32_t count)
+{
+    constexpr uint32_t FILE_ALIGNMENT    = 0x200;
+    constexpr uint32_t SECTION_ALIGNMENT = 0x1000;
+    constexpr uint32_t PE_OFFSET         = 0x80;
+    constexpr uint32_t IMPORTS_PER_DLL   = 100;
+    constexpr uint32_t RESOURCES_PER_DIR = 1000;
+
+    const uint32_t sectionsCount = std::max<uint32_t>(3, std::min<uint32_t>(count, 96));
+    const uint32_t sectionsStart = PE_OFFSET + 4 + 20 + 0xE0;
+    const uint32_t headersSize   = AlignValue(sectionsStart + sectionsCount * 40, FILE_ALIGNMENT);
+
+    struct Section {
+        std::string name;
+        Bytes content;
+        uint32_t characteristics;
+        uint32_t rva;
+    };
+    std::vector<Section> sections(sectionsCount);
+
+    // .text first, the filler sections and at the end .rdata (imports) and .rsrc (resources) => the RVA to file address
+    // translations of the imports and resources go through all the sections
+    sections[0].name = ".text";
+    sections[0].content.assign(FILE_ALIGNMENT, 0xCC);
+    const uint8_t code[] = { 0x55, 0x8B, 0xEC, 0x33, 0xC0, 0x5D, 0xC3 };
+    std::copy(std::begin(code), std::end(code), sections[0].content.begin());
+    sections[0].characteristics = 0x60000020;
+    for (uint32_t index = 1; index + 2 < sectionsCount; index++) {
+        sections[index].name = Name(".s", index, 4);
+        sections[index].content.assign(FILE_ALIGNMENT, static_cast<uint8_t>(index));
+        sections[index].characteristics = 0x40000040;
+    }
+    auto& rdata           = sections[sectionsCount - 2];
+    auto& rsrc            = sections[sectionsCount - 1];
+    rdata.name            = ".rdata";
+    rdata.characteristics = 0x40000040;
+    rsrc.name             = ".rsrc";
+    rsrc.characteristics  = 0x40000040;
+
+    // the RVAs only depend on the (aligned) size of the previous sections => .rdata and .rsrc are built after the
+    // RVAs of the first sections are known
+    uint32_t rva = SECTION_ALIGNMENT;
+    for (uint32_t index = 0; index + 2 < sectionsCount; index++) {
+        sections[index].rva = rva;
+        rva += AlignValue(static_cast<uint32_t>(sections[index].content.size()), SECTION_ALIGNMENT);
+    }
+
+    // imports: descriptors, the thunks (original + IAT) of every DLL and after them the names
+    const uint32_t dllCount  = (count + IMPORTS_PER_DLL - 1) / IMPORTS_PER_DLL;
+    const auto importsSize   = 20 * (dllCount + 1);
+    auto& imports            = rdata.content;
+    rdata.rva                = rva;
+    uint32_t thunk           = importsSize;
+    uint32_t thunksEnd       = importsSize;
+    for (uint32_t dll = 0; dll < dllCount; dll++)
+        thunksEnd += 2 * 4 * (std::min(IMPORTS_PER_DLL, count - dll * IMPORTS_PER_DLL) + 1);
+    imports.resize(thunksEnd);
+    for (uint32_t dll = 0; dll < dllCount; dll++) {
+        const auto functions     = std::min(IMPORTS_PER_DLL, count - dll * IMPORTS_PER_DLL);
+        const auto originalThunk = thunk;
+        const auto firstThunk    = thunk + (functions + 1) * 4;
+        thunk                    = firstThunk + (functions + 1) * 4;
+        for (uint32_t index = 0; index < functions; index++) {
+            const auto function = dll * IMPORTS_PER_DLL + index;
+            Set32(imports, originalThunk + index * 4, rdata.rva + static_cast<uint32_t>(imports.size()));
+            Set32(imports, firstThunk + index * 4, rdata.rva + static_cast<uint32_t>(imports.size()));
+            Put16(imports, index);
+            PutText(imports, function % 4 == 0 ? "?" + Name("Function", function) + "@@YAXH@Z" : Name("Function", function));
+            Put8(imports, 0);
+            Align(imports, 2);
+        }
+        const auto nameRVA = rdata.rva + static_cast<uint32_t>(imports.size());
+        PutText(imports, Name("library", dll, 3) + ".dll");
+        Put8(imports, 0);
+        Set32(imports, dll * 20, rdata.rva + originalThunk);
+        Set32(imports, dll * 20 + 12, nameRVA);
+        Set32(imports, dll * 20 + 16, rdata.rva + firstThunk);
+    }
+    rva += AlignValue(static_cast<uint32_t>(imports.size()), SECTION_ALIGNMENT);
+
+    // resources: root -> type -> id -> language -> data entry
+    auto& resources   = rsrc.content;
+    rsrc.rva          = rva;
+    const auto types  = (count + RESOURCES_PER_DIR - 1) / RESOURCES_PER_DIR;
+    uint32_t typeDirs = 16 + 8 * types;
+    uint32_t langDirs = typeDirs + 16 * types + 8 * count;
+    uint32_t entries  = langDirs + 24 * count;
+    uint32_t data     = entries + 16 * count;
+    auto addDirectory = [&](uint32_t idEntries) {
+        Put32(resources, 0); // characteristics
+        Put32(resources, 0); // time date stamp
+        Put16(resources, 4);
+        Put16(resources, 0);
+        Put16(resources, 0); // named entries
+        Put16(resources, idEntries);
+    };
+    addDirectory(types);
+    for (uint32_t type = 0; type < types; type++) {
+        Put32(resources, type == 0 ? 10 /* RT_RCDATA */ : 0x100 + type);
+        Put32(resources, 0x80000000 | typeDirs);
+        typeDirs += 16 + 8 * std::min(RESOURCES_PER_DIR, count - type * RESOURCES_PER_DIR);
+    }
+    for (uint32_t type = 0; type < types; type++) {
+        const auto ids = std::min(RESOURCES_PER_DIR, count - type * RESOURCES_PER_DIR);
+        addDirectory(ids);
+        for (uint32_t id = 0; id < ids; id++) {
+            Put32(resources, id + 1);
+            Put32(resources, 0x80000000 | langDirs);
+            langDirs += 24;
+        }
+    }
+    for (uint32_t index = 0; index < count; index++) {
+        addDirectory(1);
+        Put32(resources, 0x409);
+        Put32(resources, entries + index * 16);
+    }
+    for (uint32_t index = 0; index < count; index++) {
+        Put32(resources, rsrc.rva + data + index * 16);
+        Put32(resources, 16);
+        Put32(resources, 0); // code page
+        Put32(resources, 0);
+    }
+    for (uint32_t index = 0; index < count; index++)
+        PutText(resources, Name("resource_", index, 7), 16, 0);
+    const auto resourcesSize = static_cast<uint32_t>(resources.size());
+    rva += AlignValue(resourcesSize, SECTION_ALIGNMENT);
+    const auto imageSize = rva;
+
+    Bytes out;
+    // DOS header + stub
+    PutText(out, "MZ");
+    out.resize(0x3C);
+    Put32(out, PE_OFFSET);
+    out.resize(PE_OFFSET);
+    // NT headers
+    PutText(out, std::string_view("PE\0\0", 4));
+    Put16(out, 0x14C); // i386
+    Put16(out, sectionsCount);
+    Put32(out, 0x5F5E1000); // time date stamp
+    Put32(out, 0);
+    Put32(out, 0);
+    Put16(out, 0xE0);   // size of optional header
+    Put16(out, 0x0102); // executable, 32 bits
+    Put16(out, 0x10B);  // PE32
+    Put16(out, 0x0E00); // linker version
+    Put32(out, FILE_ALIGNMENT);
+    Put32(out, static_cast<uint32_t>(imports.size() + resources.size()));
+    Put32(out, 0);
+    Put32(out, sections[0].rva); // entry point
+    Put32(out, sections[0].rva); // base of code
+    Put32(out, rdata.rva);       // base of data
+    Put32(out, 0x400000);        // image base
+    Put32(out, SECTION_ALIGNMENT);
+    Put32(out, FILE_ALIGNMENT);
+    Put16(out, 6); // OS version
+    Put16(out, 0);
+    Put16(out, 0); // image version
+    Put16(out, 0);
+    Put16(out, 6); // subsystem version
+    Put16(out, 0);
+    Put32(out, 0);
+    Put32(out, imageSize);
+    Put32(out, headersSize);
+    Put32(out, 0); // checksum
+    Put16(out, 3); // console
+    Put16(out, 0x8140);
+    Put32(out, 0x100000); // stack reserve / commit, heap reserve / commit
+    Put32(out, 0x1000);
+    Put32(out, 0x100000);
+    Put32(out, 0x1000);
+    Put32(out, 0);
+    Put32(out, 16); // data directories
+    for (uint32_t index = 0; index < 16; index++) {
+        Put32(out, index == 1 ? rdata.rva : (index == 2 ? rsrc.rva : 0));
+        Put32(out, index == 1 ? importsSize : (index == 2 ? resourcesSize : 0));
+    }
+    // section table
+    uint32_t fileOffset = headersSize;
+    for (const auto& section : sections) {
+        const auto size = static_cast<uint32_t>(section.content.size());
+        PutText(out, section.name, 8, 0);
+        Put32(out, size);
+        Put32(out, section.rva);
+        Put32(out, AlignValue(size, FILE_ALIGNMENT));
+        Put32(out, fileOffset);
+        Put32(out, 0);
+        Put32(out, 0);
+        Put16(out, 0);
+        Put16(out, 0);
+        Put32(out, section.characteristics);
+        fileOffset += AlignValue(size, FILE_ALIGNMENT);
+    }
+    out.resize(headersSize);
+    for (const auto& section : sections) {
+        out.insert(out.end(), section.content.begin(), section.content.end());
+        Align(out, FILE_ALIGNMENT);
+    }
+    return out;
+}
+
+// ELF64 executable with N symbols in .symtab (a quarter are local, some have Itanium C++ mangled names)
+Bytes CreateELF(uint32_t count)
+{
+    constexpr uint64_t BASE_ADDRESS = 0x400000;
+    constexpr uint32_t HEADER_SIZE  = 64 + 56;
+
+    const uint32_t locals = count / 4;
+    Bytes text(static_cast<size_t>(count) * 16, 0xC3);
+    Bytes dataSection(static_cast<size_t>(count) * 8, 0);
+    Bytes symbols(24, 0);
+    Bytes strings(1, 0);
+    for (uint32_t index = 0; index < count; index++) {
+        const auto isFunction = index % 2 == 0;
+        std::string name;
+        if (index % 8 == 1) {
+            auto member = Name("method", index);
+            name        = "_ZN5bench" + std::to_string(member.size()) + member + "Ei";
+        } else {
+            name = isFunction ? Name("function_", index) : Name("g_variable_", index);
+        }
+        Put32(symbols, static_cast<uint32_t>(strings.size()));
+        PutText(strings, name);
+        Put8(strings, 0);
+        const auto binding = index < locals ? 0 /* local */ : 1 /* global */;
+        Put8(symbols, (binding << 4) | (isFunction ? 2 /* func */ : 1 /* object */));
+        Put8(symbols, 0);
+        Put16(symbols, isFunction ? 1 : 2); // .text / .data
+        const auto textAddress = BASE_ADDRESS + HEADER_SIZE;
+        Put64(symbols, isFunction ? textAddress + index * 16ULL : textAddress + text.size() + index * 8ULL);
+        Put64(symbols, isFunction ? 16 : 8);
+    }
+    Bytes sectionNames(1, 0);
+    auto addName = [&](std::string_view name) {
+        const auto offset = static_cast<uint32_t>(sectionNames.size());
+        PutText(sectionNames, name);
+        Put8(sectionNames, 0);
+        return offset;
+    };
+    const uint32_t names[] = { 0, addName(".text"), addName(".data"), addName(".symtab"), addName(".strtab"), addName(".shstrtab") };
+
+    const uint64_t textOffset    = HEADER_SIZE;
+    const uint64_t dataOffset    = textOffset + text.size();
+    const uint64_t symtabOffset  = dataOffset + dataSection.size();
+    const uint64_t strtabOffset  = symtabOffset + symbols.size();
+    const uint64_t shstrOffset   = strtabOffset + strings.size();
+    const uint64_t sectionsStart = (shstrOffset + sectionNames.size() + 7) / 8 * 8;
+
+    Bytes out;
+    const uint8_t ident[] = { 0x7F, 'E', 'L', 'F', 2 /* 64 bits */, 1 /* little endian */, 1, 0 };
+    out.insert(out.end(), std::begin(ident), std::end(ident));
+    out.resize(16);
+    Put16(out, 2);  // executable
+    Put16(out, 62); // x86-64
+    Put32(out, 1);
+    Put64(out, BASE_ADDRESS + textOffset); // entry point
+    Put64(out, 64);                        // program headers
+    Put64(out, sectionsStart);
+    Put32(out, 0);
+    Put16(out, 64);
+    Put16(out, 56);
+    Put16(out, 1);
+    Put16(out, 64);
+    Put16(out, 6);
+    Put16(out, 5); // .shstrtab
+    // one loadable segment (headers + .text + .data)
+    Put32(out, 1);
+    Put32(out, 5 | 2); // R + W + X
+    Put64(out, 0);
+    Put64(out, BASE_ADDRESS);
+    Put64(out, BASE_ADDRESS);
+    Put64(out, symtabOffset);
+    Put64(out, symtabOffset);
+    Put64(out, 0x1000);
+
+    out.insert(out.end(), text.begin(), text.end());
+    out.insert(out.end(), dataSection.begin(), dataSection.end());
+    out.insert(out.end(), symbols.begin(), symbols.end());
+    out.insert(out.end(), strings.begin(), strings.end());
+    out.insert(out.end(), sectionNames.begin(), sectionNames.end());
+    Align(out, 8);
+
+    auto addSection = [&](uint32_t name, uint32_t type, uint64_t flags, uint64_t offset, uint64_t size, uint32_t link, uint32_t info, uint64_t entrySize) {
+        Put32(out, name);
+        Put32(out, type);
+        Put64(out, flags);
+        Put64(out, (flags & 2) ? BASE_ADDRESS + offset : 0);
+        Put64(out, offset);
+        Put64(out, size);
+        Put32(out, link);
+        Put32(out, info);
+        Put64(out, type == 0 ? 0 : 8);
+        Put64(out, entrySize);
+    };
+    addSection(0, 0, 0, 0, 0, 0, 0, 0);
+    addSection(names[1], 1 /* progbits */, 6 /* alloc + exec */, textOffset, text.size(), 0, 0, 0);
+    addSection(names[2], 1 /* progbits */, 3 /* write + alloc */, dataOffset, dataSection.size(), 0, 0, 0);
+    addSection(names[3], 2 /* symtab */, 0, symtabOffset, symbols.size(), 4, locals + 1, 24);
+    addSection(names[4], 3 /* strtab */, 0, strtabOffset, strings.size(), 0, 0, 0);
+    addSection(names[5], 3 /* strtab */, 0, shstrOffset, sectionNames.size(), 0, 0, 0);
+    return out;
+}
+
+// Ethernet / IPv4 / TCP capture with N packets: 20 packets for each connection (handshake, HTTP requests and responses)
+// and the connections are interleaved
+Bytes CreatePCAP(uint32_t count)
+{
+    constexpr uint32_t PACKETS_PER_CONNECTION = 20;
+    constexpr uint32_t SERVER_ADDRESS         = 0x0A010001; // 10.1.0.1
+
+    const uint32_t connections = std::max<uint32_t>(1, count / PACKETS_PER_CONNECTION);
+    Bytes out;
+    Put32(out, 0xA1B2C3D4);
+    Put16(out, 2);
+    Put16(out, 4);
+    Put32(out, 0);
+    Put32(out, 0);
+    Put32(out, 65535);
+    Put32(out, 1); // ethernet
+
+    std::vector<uint32_t> sent(connections, 0);
+    std::vector<uint32_t> clientSeq(connections), serverSeq(connections);
+    for (uint32_t index = 0; index < count; index++) {
+        const auto connection = index % connections;
+        const auto step       = sent[connection]++;
+        const auto request    = step % 2 == 1;
+        const bool fromClient = step == 0 || step == 2 || (step > 2 && request);
+        uint8_t flags         = 0x10; // ACK
+        std::string payload;
+        if (step == 0) {
+            flags                 = 0x02; // SYN
+            clientSeq[connection] = 1000 + connection;
+        } else if (step == 1) {
+            flags                 = 0x12; // SYN + ACK
+            serverSeq[connection] = 5000 + connection;
+        } else if (step > 2) {
+            flags = 0x18; // PSH + ACK
+            if (fromClient) {
+                payload = "GET /item/" + std::to_string(index) + " HTTP/1.1\r\nHost: bench.local\r\nUser-Agent: GViewBench\r\n\r\n";
+            } else {
+                const auto body = "item " + std::to_string(index) + " of the synthetic capture";
+                payload = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+            }
+        }
+
+        const auto clientAddress = 0x0A000000 | (connection + 2); // 10.0.x.y
+        const auto clientPort    = 40000 + connection % 20000;
+        const auto ipLength      = static_cast<uint32_t>(20 + 20 + payload.size());
+        auto& seq                = fromClient ? clientSeq[connection] : serverSeq[connection];
+        auto& ack                = fromClient ? serverSeq[connection] : clientSeq[connection];
+
+        Put32(out, 1600000000 + index / 1000); // timestamp
+        Put32(out, (index % 1000) * 1000);
+        Put32(out, 14 + ipLength);
+        Put32(out, 14 + ipLength);
+        // ethernet
+        static const uint8_t clientMAC[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }, serverMAC[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+        const auto source = fromClient ? clientMAC : serverMAC, destination = fromClient ? serverMAC : clientMAC;
+        out.insert(out.end(), destination, destination + 6);
+        out.insert(out.end(), source, source + 6);
+        Put16BE(out, 0x0800);
+        // IPv4
+        const auto ipStart = out.size();
+        Put8(out, 0x45);
+        Put8(out, 0);
+        Put16BE(out, ipLength);
+        Put16BE(out, index & 0xFFFF);
+        Put16BE(out, 0x4000); // don't fragment
+        Put8(out, 64);
+        Put8(out, 6); // TCP
+        Put16BE(out, 0);
+        Put32BE(out, fromClient ? clientAddress : SERVER_ADDRESS);
+        Put32BE(out, fromClient ? SERVER_ADDRESS : clientAddress);
+        uint32_t checksum = 0;
+        for (auto offset = ipStart; offset < ipStart + 20; offset += 2)
+            checksum += (out[offset] << 8) | out[offset + 1];
+        checksum = (checksum & 0xFFFF) + (checksum >> 16);
+        checksum = (checksum & 0xFFFF) + (checksum >> 16);
+        out[ipStart + 10] = static_cast<uint8_t>(~checksum >> 8);
+        out[ipStart + 11] = static_cast<uint8_t>(~checksum);
+        // TCP
+        Put16BE(out, fromClient ? clientPort : 80);
+        Put16BE(out, fromClient ? 80 : clientPort);
+        Put32BE(out, seq);
+        Put32BE(out, step == 0 ? 0 : ack);
+        Put8(out, 5 << 4);
+        Put8(out, flags);
+        Put16BE(out, 65535);
+        Put16BE(out, 0);
+        Put16BE(out, 0);
+        PutText(out, payload);
+        seq += (flags & 0x02) ? 1 : static_cast<uint32_t>(payload.size());
+    }
+    return out;
+}
+
+// ZIP archive with N stored entries (one folder entry for every 50 files)
+Bytes CreateZIP(uint32_t count)
+{
+    constexpr uint32_t FILES_PER_FOLDER = 50;
+
+    Random rnd(0x5EED0100 + count);
+    Bytes out, central;
+    for (uint32_t index = 0; index < count; index++) {
+        const auto isFolder = index % (FILES_PER_FOLDER + 1) == 0;
+        const auto folder   = Name("folder_", index / (FILES_PER_FOLDER + 1), 4) + "/";
+        const auto name     = isFolder ? folder : folder + Name("file_", index) + ".txt";
+        std::string content;
+        if (!isFolder) {
+            const auto lines = 1 + rnd.Next(8);
+            for (uint32_t line = 0; line < lines; line++)
+                content += "line " + std::to_string(line) + " of entry " + std::to_string(index) + "\n";
+        }
+        const auto crc  = static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef*>(content.data()), static_cast<uInt>(content.size())));
+        const auto size = static_cast<uint32_t>(content.size());
+        const auto time = (12 << 11) | (30 << 5), date = ((2024 - 1980) << 9) | (1 << 5) | 1;
+
+        const auto localHeader = static_cast<uint32_t>(out.size());
+        Put32(out, 0x04034B50);
+        Put16(out, isFolder ? 10 : 20);
+        Put16(out, 0);
+        Put16(out, 0); // stored
+        Put16(out, time);
+        Put16(out, date);
+        Put32(out, crc);
+        Put32(out, size);
+        Put32(out, size);
+        Put16(out, static_cast<uint32_t>(name.size()));
+        Put16(out, 0);
+        PutText(out, name);
+        PutText(out, content);
+
+        Put32(central, 0x02014B50);
+        Put16(central, 0x0314); // made by: unix, 2.0
+        Put16(central, isFolder ? 10 : 20);
+        Put16(central, 0);
+        Put16(central, 0);
+        Put16(central, time);
+        Put16(central, date);
+        Put32(central, crc);
+        Put32(central, size);
+        Put32(central, size);
+        Put16(central, static_cast<uint32_t>(name.size()));
+        Put16(central, 0);
+        Put16(central, 0);
+        Put16(central, 0);
+        Put16(central, 0);
+        Put32(central, isFolder ? 0x41ED0010 : 0x81A40000); // unix permissions + MS-DOS directory attribute
+        Put32(central, localHeader);
+        PutText(central, name);
+    }
+    const auto centralOffset = static_cast<uint32_t>(out.size());
+    out.insert(out.end(), central.begin(), central.end());
+    Put32(out, 0x06054B50);
+    Put16(out, 0);
+    Put16(out, 0);
+    Put16(out, count);
+    Put16(out, count);
+    Put32(out, static_cast<uint32_t>(central.size()));
+    Put32(out, centralOffset);
+    Put16(out, 0);
+    return out;
+}
+
+// CSV file with a header and N rows (some values are quoted and contain separators or line breaks)
+Bytes CreateCSV(uint32_t count)
+{
+    Random rnd(0x5EED0200 + count);
+    Bytes out;
+    PutText(out, "id,name,offset,size,entropy,description\r\n");
+    for (uint32_t index = 0; index < count; index++) {
+        PutText(out, std::to_string(index) + "," + Name("section_", index) + ",");
+        PutText(out, std::to_string(rnd.Next(0x10000000)) + "," + std::to_string(rnd.Next(0x100000)) + ",");
+        PutText(out, std::to_string(rnd.Next(8)) + "." + std::to_string(rnd.Next(1000)) + ",");
+        switch (rnd.Next(4)) {
+        case 0:
+            PutText(out, "\"readable, writable\"");
+            break;
+        case 1:
+            PutText(out, "\"multi line\nvalue\"");
+            break;
+        default:
+            PutText(out, "plain value");
+            break;
+        }
+        PutText(out, "\r\n");
+    }
+    return out;
+}
+
+// JavaScript source with N statements (declarations, functions, conditions, loops and calls)
+Bytes CreateJS(uint32_t count)
+{
+    Bytes out;
+    PutText(out, "var total = 0;\n");
+    for (uint32_t index = 1; index < count; index++) {
+        const auto n = std::to_string(index);
+        switch (index % 6) {
+        case 0:
+            PutText(out, "var v" + n + " = " + n + " * 3 + (total >> 2);\n");
+            break;
+        case 1:
+            PutText(out, "function f" + n + "(a, b) { return a + b * " + n + "; }\n");
+            break;
+        case 2:
+            PutText(out, "if (total > " + n + ") { console.log(\"value \" + total); } else { total += " + n + "; }\n");
+            break;
+        case 3:
+            PutText(out, "let s" + n + " = \"string \" + '" + n + "' + `template ${total}`;\n");
+            break;
+        case 4:
+            PutText(out, "for (let i = 0; i < " + n + " % 17; i++) { total = (total + i) & 0xFFFF; }\n");
+            break;
+        default:
+            PutText(out, "total = f" + std::to_string(index - 4) + "(total, " + n + ");\n");
+            break;
+        }
+    }
+    return out;
+}
+
+// ISO 9660 image with N folders in the root (each folder has a file). The directory records are not padded to the
+// sector boundaries - the ISO plugin stops at the first empty record.
+Bytes CreateISO(uint32_t count)
+{
+    constexpr uint32_t SECTOR_SIZE = 2048;
+
+    auto addRecord = [](Bytes& out, std::string_view name, uint32_t extent, uint32_t size, bool isFolder) {
+        const auto length = static_cast<uint32_t>(33 + name.size() + (name.size() % 2 == 0 ? 1 : 0));
+        Put8(out, length);
+        Put8(out, 0);
+        Put32(out, extent);
+        Put32BE(out, extent);
+        Put32(out, size);
+        Put32BE(out, size);
+        const uint8_t date[] = { 124, 1, 1, 12, 30, 0, 0 };
+        out.insert(out.end(), std::begin(date), std::end(date));
+        Put8(out, isFolder ? 2 : 0);
+        Put8(out, 0);
+        Put8(out, 0);
+        Put16(out, 1);
+        Put16BE(out, 1);
+        Put8(out, static_cast<uint32_t>(name.size()));
+        PutText(out, name);
+        if (name.size() % 2 == 0)
+            Put8(out, 0);
+    };
+
+    // sectors: 16 system area, primary volume descriptor, terminator, path table, root folder, child folder, file
+    Bytes pathTable;
+    Put8(pathTable, 1);
+    Put8(pathTable, 0);
+    const auto rootExtentOffset = pathTable.size();
+    Put32(pathTable, 0);
+    Put16(pathTable, 1);
+    Put16(pathTable, 0);
+    for (uint32_t index = 0; index < count; index++) {
+        const auto name = Name("DIR", index);
+        Put8(pathTable, static_cast<uint32_t>(name.size()));
+        Put8(pathTable, 0);
+        Put32(pathTable, 0); // set below
+        Put16(pathTable, 1);
+        PutText(pathTable, name);
+        if (name.size() % 2 == 1)
+            Put8(pathTable, 0);
+    }
+    const auto pathTableSector  = 18U;
+    const auto pathTableSectors = static_cast<uint32_t>((pathTable.size() + SECTOR_SIZE - 1) / SECTOR_SIZE);
+    const auto rootSector       = pathTableSector + pathTableSectors;
+    const auto rootSize         = static_cast<uint32_t>(34 * 2 + count * 42);
+    const auto rootSectors      = rootSize / SECTOR_SIZE + 1; // at least one empty record at the end
+    const auto childSector      = rootSector + rootSectors;
+    const auto fileSector       = childSector + 1;
+    const auto totalSectors     = fileSector + 1;
+    Set32(pathTable, rootExtentOffset, rootSector);
+    for (size_t offset = 10; offset < pathTable.size(); offset += 8 + (pathTable[offset] + 1) / 2 * 2)
+        Set32(pathTable, offset + 2, childSector);
+
+    Bytes out(16 * SECTOR_SIZE, 0);
+    // primary volume descriptor
+    Put8(out, 1);
+    PutText(out, "CD001");
+    Put8(out, 1);
+    Put8(out, 0);
+    PutText(out, "GVIEWBENCH", 32, ' ');
+    PutText(out, Name("SYNTHETIC_", count), 32, ' ');
+    out.resize(out.size() + 8);
+    Put32(out, totalSectors);
+    Put32BE(out, totalSectors);
+    out.resize(out.size() + 32);
+    Put16(out, 1);
+    Put16BE(out, 1);
+    Put16(out, 1);
+    Put16BE(out, 1);
+    Put16(out, SECTOR_SIZE);
+    Put16BE(out, SECTOR_SIZE);
+    Put32(out, static_cast<uint32_t>(pathTable.size()));
+    Put32BE(out, static_cast<uint32_t>(pathTable.size()));
+    Put32(out, pathTableSector);
+    Put32(out, 0);
+    Put32BE(out, 0);
+    Put32BE(out, 0);
+    addRecord(out, std::string_view("\0", 1), rootSector, rootSectors * SECTOR_SIZE, true);
+    out.resize(16 * SECTOR_SIZE + 881);
+    Put8(out, 1); // file structure version
+    out.resize(17 * SECTOR_SIZE);
+    // terminator
+    Put8(out, 255);
+    PutText(out, "CD001");
+    Put8(out, 1);
+    out.resize(18 * SECTOR_SIZE);
+    out.insert(out.end(), pathTable.begin(), pathTable.end());
+    out.resize(static_cast<size_t>(rootSector) * SECTOR_SIZE);
+    // root folder
+    addRecord(out, std::string_view("\0", 1), rootSector, rootSectors * SECTOR_SIZE, true);
+    addRecord(out, std::string_view("\1", 1), rootSector, rootSectors * SECTOR_SIZE, true);
+    for (uint32_t index = 0; index < count; index++)
+        addRecord(out, Name("DIR", index), childSector, SECTOR_SIZE, true);
+    out.resize(static_cast<size_t>(childSector) * SECTOR_SIZE);
+    // every folder points to the same extent (the size of the image does not grow with N)
+    addRecord(out, std::string_view("\0", 1), childSector, SECTOR_SIZE, true);
+    addRecord(out, std::string_view("\1", 1), rootSector, rootSectors * SECTOR_SIZE, true);
+    addRecord(out, "README.TXT;1", fileSector, 64, false);
+    out.resize(static_cast<size_t>(fileSector) * SECTOR_SIZE);
+    PutText(out, "synthetic file used by the GViewBench ISO benchmarks", SECTOR_SIZE, ' ');
+    return out;
+}
+} // namespace
+
+bool CreateTypes(const std::filesystem::path& folder)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(folder, ec);
+
+    auto ok = true;
+    for (auto count : ITEMS) {
+        const auto n = std::to_string(count);
+        ok           = ok && Write(folder, "pe_" + n + ".exe", CreatePE(count));
+        ok           = ok && Write(folder, "elf_" + n + ".so", CreateELF(count));
+        ok           = ok && Write(folder, "pcap_" + n + ".pcap", CreatePCAP(count));
+        ok           = ok && Write(folder, "zip_" + n + ".zip", CreateZIP(count));
+        ok           = ok && Write(folder, "csv_" + n + ".csv", CreateCSV(count));
+        ok           = ok && Write(folder, "js_" + n + ".js", CreateJS(count));
+        ok           = ok && Write(folder, "iso_" + n + ".iso", CreateISO(count));
+    }
+    return ok;
+}
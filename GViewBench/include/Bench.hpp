@@ -0,0 +1,71 @@
+#pragma once
+
+#include "GView.hpp"
+
+#include <functional>
+
+namespace GView::Bench
+{
+// one timed iteration - the returned value is added to a checksum (the work can not be removed by the optimizer and
+// two runs over the same corpus must report the same checksum)
+using Body = std::function<uint64()>;
+// creates the state of a benchmark (only called if the benchmark was selected) and returns the body
+// "bytes" is set to the number of bytes processed by one iteration (left 0 if the throughput is not relevant)
+// an empty body means that the benchmark can not run (the reason is set via Fail)
+using Setup = std::function<Body(uint64& bytes)>;
+
+struct Benchmark {
+    std::string group;
+    std::string name;
+    Setup setup;
+};
+
+void Add(std::string_view group, std::string_view name, Setup setup);
+const std::vector<Benchmark>& GetBenchmarks();
+Body Fail(std::string_view reason);
+std::string_view GetLastError();
+
+namespace Corpus
+{
+    bool Load(const std::filesystem::path& folder);
+    // entire content of a corpus file (loaded in memory only once)
+    BufferView Get(std::string_view name);
+    std::filesystem::path GetPath(std::string_view name);
+} // namespace Corpus
+
+// resident memory of the process (bytes)
+namespace Memory
+{
+    // only possible on Linux - on Windows and macOS the peak is the one of the entire process
+    void ResetPeak();
+    uint64 GetCurrent();
+    uint64 GetPeak();
+} // namespace Memory
+
+// deterministic pseudo random sequence (the same offsets / sizes are used in every run)
+class Random
+{
+    uint64 state;
+
+  public:
+    explicit Random(uint64 seed) : state(seed)
+    {
+    }
+    uint64 Next();
+    inline uint64 Next(uint64 limit)
+    {
+        return Next() % limit;
+    }
+};
+
+void RegisterDataCache();
+void RegisterBytePattern();
+void RegisterHashes();
+void RegisterEntropy();
+void RegisterEncoding();
+void RegisterRegex();
+void RegisterZonesList();
+void RegisterMatchers();
+void RegisterDecoding();
+void RegisterTypes();
+} // namespace GView::Bench
@@ -0,0 +1,147 @@
+#include "Bench.hpp"
+
+#include <charconv>
+#include <regex>
+
+namespace GView::Bench
+{
+using namespace GView::Utils;
+
+constexpr uint32 CACHE_SIZE              = 0xA00000; // same as the default cache size of GView (10 MB)
+constexpr uint32 MAX_REGEX_MATCH_OVERLAP = 0x400;    // overlap used by the find dialog for regular expressions
+
+// input of the find dialog: hex bytes separated through spaces ("?" - any byte) or plain text
+struct Pattern {
+    std::vector<uint8> bytes;
+    std::vector<uint8> mask;
+    bool ignoreCase;
+};
+
+static Pattern FromHex(std::string_view input, bool ignoreCase)
+{
+    Pattern pattern{ {}, {}, ignoreCase };
+    for (size_t start = 0; start < input.size();) {
+        auto next = input.find(' ', start);
+        if (next == std::string_view::npos)
+            next = input.size();
+        const auto number = input.substr(start, next - start);
+        uint8 value       = 0;
+        if (number[0] != '?')
+            std::from_chars(number.data(), number.data() + number.size(), value, 16);
+        pattern.bytes.push_back(value);
+        pattern.mask.push_back(number[0] == '?' ? BytePattern::ANY : BytePattern::EXACT);
+        start = next + 1;
+    }
+    return pattern;
+}
+
+static Pattern FromText(std::string_view input, bool ignoreCase)
+{
+    return { std::vector<uint8>(input.begin(), input.end()), std::vector<uint8>(input.size(), BytePattern::EXACT), ignoreCase };
+}
+
+// the expression the find dialog used to build for a byte pattern: "\xNN" for a byte and a class for a wildcard ("[\x00-\xFF]" in
+// the dialog - an invalid range where char is signed => "[\s\S]" that also matches any byte)
+static std::string ToRegex(const Pattern& pattern)
+{
+    std::string expression;
+    char hex[8];
+    for (size_t index = 0; index < pattern.bytes.size(); index++) {
+        if (pattern.mask[index] == BytePattern::ANY) {
+            expression += "[\\s\\S]";
+        } else {
+            snprintf(hex, sizeof(hex), "\\x%02x", pattern.bytes[index]);
+            expression += hex;
+        }
+    }
+    return expression;
+}
+
+static std::shared_ptr<DataCache> OpenCache(std::string_view file)
+{
+    auto cache = std::make_shared<DataCache>();
+    CHECK(cache->Init(Corpus::GetPath(file), CACHE_SIZE, false), nullptr, "");
+    return cache;
+}
+
+// all the matches in a file streamed through a DataCache (chunks that overlap, the way the find dialog walks a file) - the matches
+// from an overlap are counted once => both searchers report the same checksum. A multi-GB file can be used via --corpus.
+template <typename Fn>
+static uint64 CountMatches(DataCache& cache, uint32 overlap, Fn&& findAll)
+{
+    uint64 count = 0, next = 0;
+    cache.ForEachChunk(0, cache.GetSize(), 0, overlap, [&](uint64 chunkOffset, BufferView buffer) {
+        findAll(buffer, [&](uint64 position) {
+            if (chunkOffset + position >= next) {
+                count++;
+                next = chunkOffset + position + 1;
+            }
+        });
+        return true;
+    });
+    return count;
+}
+
+static Setup FindAllStdRegex(std::string_view file, Pattern pattern)
+{
+    return [=](uint64& bytes) -> Body {
+        auto cache = OpenCache(file);
+        if (!cache)
+            return Fail("fail to open the corpus file");
+        auto flags = std::regex_constants::ECMAScript | std::regex_constants::optimize;
+        if (pattern.ignoreCase)
+            flags |= std::regex_constants::icase;
+        auto expression = std::make_shared<std::regex>(ToRegex(pattern), flags);
+        bytes           = cache->GetSize();
+        return [cache, expression]() {
+            return CountMatches(*cache, MAX_REGEX_MATCH_OVERLAP, [&](BufferView buffer, auto&& onMatch) {
+                const auto begin = reinterpret_cast<const char*>(buffer.GetData());
+                const auto end   = begin + buffer.GetLength();
+                std::cmatch matches;
+                for (auto start = begin; std::regex_search(start, end, matches, *expression);) {
+                    onMatch((start - begin) + matches.position());
+                    start += matches.position() + 1;
+                }
+            });
+        };
+    };
+}
+
+static Setup FindAllBytePattern(std::string_view file, Pattern pattern)
+{
+    return [=](uint64& bytes) -> Body {
+        auto cache = OpenCache(file);
+        if (!cache)
+            return Fail("fail to open the corpus file");
+        auto searcher = std::make_shared<BytePattern>();
+        if (!searcher->Init(BufferView(pattern.bytes.data(), pattern.bytes.size()), BufferView(pattern.mask.data(), pattern.mask.size()), pattern.ignoreCase))
+            return Fail("invalid pattern");
+        bytes = cache->GetSize();
+        return [cache, searcher]() {
+            return CountMatches(*cache, searcher->GetLength() - 1, [&](BufferView buffer, auto&& onMatch) {
+                size_t start = 0, position = 0;
+                while (searcher->Find(buffer, start, position)) {
+                    onMatch(position);
+                    start = position + 1;
+                }
+            });
+        };
+    };
+}
+
+static void AddSearch(std::string_view name, std::string_view file, const Pattern& pattern)
+{
+    Add("BytePattern", std::string("StdRegex.") + std::string(name), FindAllStdRegex(file, pattern));
+    Add("BytePattern", std::string("Search.") + std::string(name), FindAllBytePattern(file, pattern));
+}
+
+void RegisterBytePattern()
+{
+    AddSearch("Literal.Random", "random.bin", FromHex("DE AD BE EF", false));
+    AddSearch("Literal.Binary", "binary.bin", FromHex("4D 5A 90 00 03 00", false));
+    AddSearch("Wildcards.Binary", "binary.bin", FromHex("? ? ? 40 01 00 00 00", false));
+    AddSearch("Wildcards.Random", "random.bin", FromHex("E8 ? ? ? ? 48 8B", false));
+    AddSearch("Text.Literal", "text.txt", FromText("address 99", false));
+    AddSearch("Text.IgnoreCase", "text.txt", FromText("gview parser", true));
+}
+} // namespace GView::Bench
@@ -0,0 +1,75 @@
+#include "Bench.hpp"
+
+#include <map>
+
+namespace GView::Bench
+{
+namespace
+{
+    std::vector<Benchmark> benchmarks;
+    std::string lastError;
+
+    struct CorpusData {
+        std::filesystem::path folder;
+        std::map<std::string, Buffer, std::less<>> files;
+    } corpus;
+} // namespace
+
+void Add(std::string_view group, std::string_view name, Setup setup)
+{
+    benchmarks.push_back({ std::string(group), std::string(name), std::move(setup) });
+}
+
+const std::vector<Benchmark>& GetBenchmarks()
+{
+    return benchmarks;
+}
+
+Body Fail(std::string_view reason)
+{
+    lastError = reason;
+    return {};
+}
+
+std::string_view GetLastError()
+{
+    return lastError;
+}
+
+uint64 Random::Next()
+{
+    // splitmix64 (same generator as the corpus generator)
+    uint64 z = (state += 0x9E3779B97F4A7C15ULL);
+    z        = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z        = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+namespace Corpus
+{
+    bool Load(const std::filesystem::path& folder)
+    {
+        std::error_code ec;
+        CHECK(std::filesystem::is_directory(folder, ec), false, "Corpus folder not found: %s", folder.u8string().c_str());
+        corpus.folder = folder;
+        corpus.files.clear();
+        return true;
+    }
+
+    BufferView Get(std::string_view name)
+    {
+        auto it = corpus.files.find(name);
+        if (it == corpus.files.end()) {
+            auto content = AppCUI::OS::File::ReadContent(GetPath(name));
+            CHECK(content.IsValid(), BufferView(), "Fail to read corpus file: %s", std::string(name).c_str());
+            it = corpus.files.emplace(std::string(name), std::move(content)).first;
+        }
+        return it->second;
+    }
+
+    std::filesystem::path GetPath(std::string_view name)
+    {
+        return corpus.folder / name;
+    }
+} // namespace Corpus
+} // namespace GView::Bench
@@ -0,0 +1,90 @@
+#include "Bench.hpp"
+
+namespace GView::Bench
+{
+using namespace GView::Utils;
+
+constexpr uint32 CACHE_SIZE            = 0xA00000; // same as the default cache size of GView (10 MB)
+constexpr uint32 RANDOM_READS          = 4096;
+constexpr uint32 RANDOM_LENGTH         = 256;
+constexpr std::string_view CORPUS_FILE = "random.bin";
+
+static std::shared_ptr<DataCache> OpenCache(bool useMemoryMapping)
+{
+    auto cache = std::make_shared<DataCache>();
+    CHECK(cache->Init(Corpus::GetPath(CORPUS_FILE), CACHE_SIZE, useMemoryMapping), nullptr, "");
+    return cache;
+}
+
+// sequential scan (Get) with a fixed request size - the way the viewers and the plugins walk a file
+static Setup Sequential(bool useMemoryMapping, uint32 requestSize)
+{
+    return [=](uint64& bytes) -> Body {
+        auto cache = OpenCache(useMemoryMapping);
+        if (!cache)
+            return Fail("fail to open the corpus file");
+        bytes = cache->GetSize();
+        return [cache, requestSize]() {
+            uint64 sum        = 0;
+            const auto length = cache->GetSize();
+            for (uint64 offset = 0; offset < length; offset += requestSize) {
+                auto view = cache->Get(offset, requestSize, false);
+                sum += view.GetLength() + (view.IsValid() ? view[0] : 0);
+            }
+            return sum;
+        };
+    };
+}
+
+// small requests at random offsets (structure parsing, zone / selection lookups)
+static Setup RandomAccess(bool useMemoryMapping)
+{
+    return [=](uint64& bytes) -> Body {
+        auto cache = OpenCache(useMemoryMapping);
+        if (!cache)
+            return Fail("fail to open the corpus file");
+        auto offsets = std::make_shared<std::vector<uint64>>(RANDOM_READS);
+        Random rnd(0xDA7A0001);
+        for (auto& offset : *offsets)
+            offset = rnd.Next(cache->GetSize() - RANDOM_LENGTH);
+        bytes = RANDOM_READS * RANDOM_LENGTH;
+        return [cache, offsets]() {
+            uint64 sum = 0;
+            for (auto offset : *offsets) {
+                auto view = cache->Get(offset, RANDOM_LENGTH, true);
+                sum += view.GetLength() + (view.IsValid() ? view[RANDOM_LENGTH - 1] : 0);
+            }
+            return sum;
+        };
+    };
+}
+
+static Setup CopyToBuffer(uint32 requestSize)
+{
+    return [=](uint64& bytes) -> Body {
+        auto cache = OpenCache(false);
+        if (!cache)
+            return Fail("fail to open the corpus file");
+        bytes = cache->GetSize();
+        return [cache, requestSize]() {
+            uint64 sum        = 0;
+            const auto length = cache->GetSize();
+            for (uint64 offset = 0; offset < length; offset += requestSize) {
+                auto buffer = cache->CopyToBuffer(offset, static_cast<uint32>(std::min<uint64>(requestSize, length - offset)));
+                sum += buffer.GetLength() + (buffer.IsValid() ? buffer[0] : 0);
+            }
+            return sum;
+        };
+    };
+}
+
+void RegisterDataCache()
+{
+    Add("DataCache", "Get.Sequential.4K", Sequential(false, 0x1000));
+    Add("DataCache", "Get.Sequential.64K", Sequential(false, 0x10000));
+    Add("DataCache", "Get.Sequential.4K.MemoryMapped", Sequential(true, 0x1000));
+    Add("DataCache", "Get.Random.256", RandomAccess(false));
+    Add("DataCache", "Get.Random.256.MemoryMapped", RandomAccess(true));
+    Add("DataCache", "CopyToBuffer.64K", CopyToBuffer(0x10000));
+}
+} // namespace GView::Bench
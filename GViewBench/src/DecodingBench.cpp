@@ -0,0 +1,95 @@
+#include "Bench.hpp"
+
+namespace GView::Bench
+{
+// must be the same as the sizes used by the corpus generator (text.xpress = the first 4 MB of text.txt,
+// base64.txt = the first 6 MB of random.bin)
+constexpr uint32 XPRESS_SIZE = 4 * 1024 * 1024;
+constexpr uint32 BASE64_SIZE = 6 * 1024 * 1024;
+
+static bool SameContent(BufferView decoded, BufferView original, size_t size)
+{
+    return (decoded.GetLength() == size) && (original.GetLength() >= size) && (memcmp(decoded.GetData(), original.GetData(), size) == 0);
+}
+
+static Body Base64Decode(uint64& bytes)
+{
+    auto content  = Corpus::Get("base64.txt");
+    auto original = Corpus::Get("random.bin");
+    if (!content.IsValid() || !original.IsValid())
+        return Fail("fail to load the corpus files");
+    Buffer output;
+    if (!Decoding::Base64::Decode(content, output) || !SameContent(output, original, BASE64_SIZE))
+        return Fail("the decoded content is different from the corpus");
+    bytes = content.GetLength();
+    return [content]() {
+        Buffer output;
+        Decoding::Base64::Decode(content, output);
+        return static_cast<uint64>(output.GetLength());
+    };
+}
+
+static Body Base64Encode(uint64& bytes)
+{
+    auto original = Corpus::Get("random.bin");
+    if (original.GetLength() < BASE64_SIZE)
+        return Fail("fail to load the corpus file");
+    BufferView content(original.GetData(), BASE64_SIZE);
+    bytes = content.GetLength();
+    return [content]() {
+        Buffer output;
+        Decoding::Base64::Encode(content, output);
+        return static_cast<uint64>(output.GetLength());
+    };
+}
+
+static Body ZLIBDecompress(uint64& bytes)
+{
+    auto compressed = Corpus::Get("text.zlib");
+    auto original   = Corpus::Get("text.txt");
+    if (!compressed.IsValid() || !original.IsValid())
+        return Fail("fail to load the corpus files");
+    // Decompress requires a Buffer (not a view) => one copy, done outside of the timed part
+    auto input = std::make_shared<Buffer>();
+    input->Resize(compressed.GetLength());
+    memcpy(input->GetData(), compressed.GetData(), compressed.GetLength());
+    const auto outputSize = original.GetLength();
+    Buffer output;
+    if (!Decoding::ZLIB::Decompress(*input, input->GetLength(), output, outputSize) || !SameContent(output, original, outputSize))
+        return Fail("the decompressed content is different from the corpus");
+    bytes = outputSize;
+    return [input, outputSize]() {
+        Buffer output;
+        Decoding::ZLIB::Decompress(*input, input->GetLength(), output, outputSize);
+        return static_cast<uint64>(output.GetLength()) + output[outputSize - 1];
+    };
+}
+
+static Body LZXPRESSDecompress(uint64& bytes)
+{
+    auto compressed = Corpus::Get("text.xpress");
+    auto original   = Corpus::Get("text.txt");
+    if (!compressed.IsValid() || !original.IsValid())
+        return Fail("fail to load the corpus files");
+    // the size of the output must be known before the decompression
+    Buffer output;
+    output.Resize(XPRESS_SIZE);
+    if (!Decoding::LZXPRESS::Huffman::Decompress(compressed, output) || !SameContent(output, original, XPRESS_SIZE))
+        return Fail("the decompressed content is different from the corpus");
+    bytes = XPRESS_SIZE;
+    return [compressed]() {
+        Buffer output;
+        output.Resize(XPRESS_SIZE);
+        Decoding::LZXPRESS::Huffman::Decompress(compressed, output);
+        return static_cast<uint64>(output[XPRESS_SIZE - 1]);
+    };
+}
+
+void RegisterDecoding()
+{
+    Add("Decoding", "Base64.Decode", Base64Decode);
+    Add("Decoding", "Base64.Encode", Base64Encode);
+    Add("Decoding", "ZLIB.Decompress", ZLIBDecompress);
+    Add("Decoding", "LZXPRESS.Huffman.Decompress", LZXPRESSDecompress);
+}
+} // namespace GView::Bench
@@ -0,0 +1,60 @@
+#include "Bench.hpp"
+#include "Internal.hpp"
+
+namespace GView::Bench
+{
+using namespace GView::Utils;
+
+// the text based viewers and the type matchers convert buffers of a few KB
+constexpr uint32 BLOCK_SIZE = 0x4000;
+
+static Setup ConvertToUnicode16(std::string_view file)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(file);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        bytes = content.GetLength();
+        return [content]() {
+            uint64 sum = 0;
+            for (size_t offset = 0; offset < content.GetLength(); offset += BLOCK_SIZE) {
+                auto text = CharacterEncoding::ConvertToUnicode16(
+                      BufferView(content.GetData() + offset, std::min<size_t>(BLOCK_SIZE, content.GetLength() - offset)));
+                sum += text.size + (text.size > 0 ? text.text[text.size - 1] : 0);
+                text.Destroy();
+            }
+            return sum;
+        };
+    };
+}
+
+static Setup AnalyzeBufferForEncoding(std::string_view file)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(file);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        bytes = content.GetLength();
+        return [content]() {
+            uint64 sum = 0;
+            for (size_t offset = 0; offset < content.GetLength(); offset += BLOCK_SIZE) {
+                uint32 bomLength = 0;
+                auto encoding    = CharacterEncoding::AnalyzeBufferForEncoding(
+                      BufferView(content.GetData() + offset, std::min<size_t>(BLOCK_SIZE, content.GetLength() - offset)), offset == 0, bomLength);
+                sum += static_cast<uint64>(encoding) + bomLength;
+            }
+            return sum;
+        };
+    };
+}
+
+void RegisterEncoding()
+{
+    Add("Encoding", "ConvertToUnicode16.ASCII", ConvertToUnicode16("text.txt"));
+    Add("Encoding", "ConvertToUnicode16.UTF8", ConvertToUnicode16("utf8.txt"));
+    Add("Encoding", "ConvertToUnicode16.UTF16", ConvertToUnicode16("utf16.txt"));
+    Add("Encoding", "ConvertToUnicode16.Binary", ConvertToUnicode16("binary.bin"));
+    Add("Encoding", "AnalyzeBufferForEncoding.UTF8", AnalyzeBufferForEncoding("utf8.txt"));
+    Add("Encoding", "AnalyzeBufferForEncoding.Binary", AnalyzeBufferForEncoding("binary.bin"));
+}
+} // namespace GView::Bench
@@ -0,0 +1,70 @@
+#include "Bench.hpp"
+
+#include <cmath>
+
+namespace GView::Bench
+{
+// the entropy visualizer computes one value for each block of the file
+constexpr uint32 BLOCK_SIZE = 0x1000;
+
+template <typename Function>
+static Setup Blocks(std::string_view file, Function fn)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(file);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        bytes = content.GetLength();
+        return [content, fn]() {
+            double sum = 0;
+            for (size_t offset = 0; offset < content.GetLength(); offset += BLOCK_SIZE)
+                sum += fn(BufferView(content.GetData() + offset, std::min<size_t>(BLOCK_SIZE, content.GetLength() - offset)));
+            // fixed point value => the checksum is stable (no floating point formatting)
+            return static_cast<uint64>(std::llround(sum * 1000.0));
+        };
+    };
+}
+
+// one counter per value (the counting loop before the interleaved sub-histograms) - baseline for the histogram throughput
+static double ReferenceHistogram(BufferView block)
+{
+    Entropy::Histogram histogram{};
+    for (size_t i = 0; i < block.GetLength(); i++)
+        histogram[block[i]]++;
+    return static_cast<double>(histogram[0]);
+}
+
+// one classifier reused for all the blocks (as each worker of the entropy visualizer does)
+static Setup ClassifyBlocks(std::string_view file)
+{
+    auto classifier = std::make_shared<Entropy::RegionClassifier>();
+    return Blocks(file, [classifier](BufferView block) {
+        classifier->Reset();
+        classifier->Update(block);
+        return static_cast<double>(classifier->GetRegionType());
+    });
+}
+
+void RegisterEntropy()
+{
+    auto shannon   = [](BufferView block) { return Entropy::ShannonEntropy(block); };
+    auto renyi     = [](BufferView block) { return Entropy::RenyiEntropy(block, 2.0); };
+    auto histogram = [](BufferView block) {
+        Entropy::Histogram histogram{};
+        Entropy::UpdateHistogram(block, histogram);
+        return static_cast<double>(histogram[0]);
+    };
+    Add("Entropy", "Histogram.Reference.Random", Blocks("random.bin", ReferenceHistogram));
+    Add("Entropy", "Histogram.Reference.Binary", Blocks("binary.bin", ReferenceHistogram));
+    Add("Entropy", "Histogram.Random", Blocks("random.bin", histogram));
+    Add("Entropy", "Histogram.Binary", Blocks("binary.bin", histogram));
+    Add("Entropy", "Histogram.Text", Blocks("text.txt", histogram));
+    Add("Entropy", "Shannon.Random", Blocks("random.bin", shannon));
+    Add("Entropy", "Shannon.Binary", Blocks("binary.bin", shannon));
+    Add("Entropy", "Shannon.Text", Blocks("text.txt", shannon));
+    Add("Entropy", "Renyi.Binary", Blocks("binary.bin", renyi));
+    Add("Entropy", "Classify.Random", ClassifyBlocks("random.bin"));
+    Add("Entropy", "Classify.Binary", ClassifyBlocks("binary.bin"));
+    Add("Entropy", "Classify.Text", ClassifyBlocks("text.txt"));
+}
+} // namespace GView::Bench
@@ -0,0 +1,149 @@
+#include "Bench.hpp"
+
+namespace GView::Bench
+{
+using namespace GView::Hashes;
+
+// the Hashes plugin feeds the algorithms with chunks of the file (the size of a cache page)
+constexpr uint32 CHUNK_SIZE            = 0x10000;
+constexpr std::string_view CORPUS_FILE = "random.bin";
+
+template <typename Hash, typename Result, typename... InitArgs>
+static Setup Checksum(InitArgs... args)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(CORPUS_FILE);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        bytes = content.GetLength();
+        return [content, args...]() -> uint64 {
+            Hash hash;
+            Result result{};
+            CHECK(hash.Init(args...), 0, "");
+            for (size_t offset = 0; offset < content.GetLength(); offset += CHUNK_SIZE) {
+                auto size = static_cast<uint32>(std::min<size_t>(CHUNK_SIZE, content.GetLength() - offset));
+                hash.Update(content.GetData() + offset, size);
+            }
+            CHECK(hash.Final(result), 0, "");
+            return result;
+        };
+    };
+}
+
+static bool SetImplementation(CRCImplementation implementation)
+{
+    return SetCRCImplementation(implementation);
+}
+static bool SetImplementation(Adler32Implementation implementation)
+{
+    return SetAdler32Implementation(implementation);
+}
+static CRCImplementation GetImplementation(CRCImplementation)
+{
+    return GetCRCImplementation();
+}
+static Adler32Implementation GetImplementation(Adler32Implementation)
+{
+    return GetAdler32Implementation();
+}
+
+// checksum with a fixed kernel (the previous one is restored)
+template <typename Hash, typename Result, typename Implementation, typename... InitArgs>
+static uint64 CalculateWith(Implementation implementation, BufferView content, InitArgs... args)
+{
+    const auto previous = GetImplementation(implementation);
+    CHECK(SetImplementation(implementation), 0, "");
+    Hash hash;
+    Result result{};
+    hash.Init(args...);
+    for (size_t offset = 0; offset < content.GetLength(); offset += CHUNK_SIZE) {
+        auto size = static_cast<uint32>(std::min<size_t>(CHUNK_SIZE, content.GetLength() - offset));
+        hash.Update(content.GetData() + offset, size);
+    }
+    SetImplementation(previous);
+    CHECK(hash.Final(result), 0, "");
+    return result;
+}
+
+// the setup fails if the kernel is not supported by the CPU or if its result is not the one of the "reference" kernel
+template <typename Hash, typename Result, typename Implementation, typename... InitArgs>
+static Setup Kernel(Implementation implementation, Implementation reference, InitArgs... args)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(CORPUS_FILE);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        const auto previous = GetImplementation(implementation);
+        if (!SetImplementation(implementation))
+            return Fail("the implementation is not supported by this CPU");
+        SetImplementation(previous);
+        if (CalculateWith<Hash, Result>(implementation, content, args...) != CalculateWith<Hash, Result>(reference, content, args...))
+            return Fail("the result is different from the one of the reference implementation");
+        bytes = content.GetLength();
+        return [content, implementation, args...]() -> uint64 { return CalculateWith<Hash, Result>(implementation, content, args...); };
+    };
+}
+
+static Setup OpenSSL(OpenSSLHashKind kind)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(CORPUS_FILE);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        bytes = content.GetLength();
+        return [content, kind]() -> uint64 {
+            OpenSSLHash hash(kind);
+            for (size_t offset = 0; offset < content.GetLength(); offset += CHUNK_SIZE) {
+                auto size = static_cast<uint32>(std::min<size_t>(CHUNK_SIZE, content.GetLength() - offset));
+                hash.Update(content.GetData() + offset, size);
+            }
+            CHECK(hash.Final(), 0, "");
+            uint64 result = 0;
+            memcpy(&result, hash.Get(), std::min<uint32>(sizeof(result), hash.GetSize()));
+            return result;
+        };
+    };
+}
+
+void RegisterHashes()
+{
+    Add("Hashes", "Adler32", Checksum<Adler32, uint32>());
+    Add("Hashes", "CRC16", Checksum<CRC16, uint16>());
+    Add("Hashes", "CRC32.JAMCRC", Checksum<CRC32, uint32>(CRC32Type::JAMCRC));
+    Add("Hashes", "CRC64.ECMA_182", Checksum<CRC64, uint64>(CRC64Type::ECMA_182));
+    constexpr std::pair<std::string_view, CRCImplementation> CRC_IMPLEMENTATIONS[] = {
+        { "Table", CRCImplementation::Table },
+        { "Slicing", CRCImplementation::Slicing },
+        { "CarrylessMultiply", CRCImplementation::CarrylessMultiply },
+    };
+    constexpr std::pair<std::string_view, Adler32Implementation> ADLER32_IMPLEMENTATIONS[] = {
+        { "Scalar", Adler32Implementation::Scalar },
+        { "SSSE3", Adler32Implementation::SSSE3 },
+        { "AVX2", Adler32Implementation::AVX2 },
+        { "NEON", Adler32Implementation::NEON },
+    };
+    LocalString<64> name;
+    for (const auto& [implementation, value] : CRC_IMPLEMENTATIONS) {
+        Add("Hashes",
+            name.Format("CRC16.%.*s", (int) implementation.size(), implementation.data()),
+            Kernel<CRC16, uint16>(value, CRCImplementation::Table));
+        Add("Hashes",
+            name.Format("CRC32.JAMCRC.%.*s", (int) implementation.size(), implementation.data()),
+            Kernel<CRC32, uint32>(value, CRCImplementation::Table, CRC32Type::JAMCRC));
+        Add("Hashes",
+            name.Format("CRC64.ECMA_182.%.*s", (int) implementation.size(), implementation.data()),
+            Kernel<CRC64, uint64>(value, CRCImplementation::Table, CRC64Type::ECMA_182));
+    }
+    for (const auto& [implementation, value] : ADLER32_IMPLEMENTATIONS) {
+        Add("Hashes",
+            name.Format("Adler32.%.*s", (int) implementation.size(), implementation.data()),
+            Kernel<Adler32, uint32>(value, Adler32Implementation::Scalar));
+    }
+    Add("Hashes", "MD5", OpenSSL(OpenSSLHashKind::Md5));
+    Add("Hashes", "SHA1", OpenSSL(OpenSSLHashKind::Sha1));
+    Add("Hashes", "SHA256", OpenSSL(OpenSSLHashKind::Sha256));
+    Add("Hashes", "SHA512", OpenSSL(OpenSSLHashKind::Sha512));
+    Add("Hashes", "SHA3-256", OpenSSL(OpenSSLHashKind::Sha3_256));
+    Add("Hashes", "BLAKE2b512", OpenSSL(OpenSSLHashKind::Blake2b512));
+}
+} // namespace GView::Bench
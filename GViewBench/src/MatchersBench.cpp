@@ -0,0 +1,121 @@
+#include "Bench.hpp"
+#include "Internal.hpp"
+
+namespace GView::Bench
+{
+using namespace GView::Type::Matcher;
+
+// the patterns of the type plugins (gview.ini)
+constexpr std::string_view PATTERNS[] = {
+    "magic:4D 5A",
+    "magic:7F 45 4C 46",
+    "magic:42 4D",
+    "magic:D0 CF 11 E0 A1 B1 1A E1",
+    "magic:CA FE BA BE",
+    "magic:FF D8",
+    "magic:4C 00 00 00",
+    "magic:4D 41 4D 04",
+    "magic:A1 B2 C3 D4",
+    "magic:D4 C3 B2 A1",
+    "magic:89 50 4E 47",
+    "magic:78 9C",
+    "magic:50 4B 03 04",
+    "startswith:<?xml",
+    "startswith:{",
+    "linestartswith:#include",
+    "linestartswith:#pragma",
+    "linestartswith:#define",
+    "linestartswith:import",
+    "linestartswith:function",
+};
+// the first bytes of the files that are identified (the plugins read a buffer of this size)
+constexpr uint32 BUFFER_SIZE   = 0x1000;
+constexpr uint32 BUFFERS_COUNT = 512;
+
+struct MatchersData {
+    std::vector<std::unique_ptr<Interface>> matchers;
+    std::vector<Buffer> buffers;
+};
+
+static std::shared_ptr<MatchersData> CreateData()
+{
+    auto data = std::make_shared<MatchersData>();
+    for (auto pattern : PATTERNS) {
+        auto matcher = CreateFromString(pattern);
+        CHECK(matcher, nullptr, "Invalid pattern: %.*s", static_cast<int>(pattern.size()), pattern.data());
+        data->matchers.emplace_back(matcher);
+    }
+
+    // half binary, half text - and some of them start with a known signature
+    auto binary = Corpus::Get("binary.bin");
+    auto text   = Corpus::Get("text.txt");
+    CHECK(binary.IsValid() && text.IsValid(), nullptr, "");
+    Random rnd(0x3A7C0001);
+    for (auto index = 0U; index < BUFFERS_COUNT; index++) {
+        const auto& source = (index & 1) ? text : binary;
+        Buffer buffer;
+        buffer.Resize(BUFFER_SIZE);
+        memcpy(buffer.GetData(), source.GetData() + rnd.Next(source.GetLength() - BUFFER_SIZE), BUFFER_SIZE);
+        if (rnd.Next(4) == 0) {
+            static const uint8 signatures[][4] = { { 0x4D, 0x5A, 0x90, 0 }, { 0x7F, 0x45, 0x4C, 0x46 }, { 0x50, 0x4B, 3, 4 }, { '#', 'i', 'n', 'c' } };
+            memcpy(buffer.GetData(), signatures[rnd.Next(std::size(signatures))], 4);
+        }
+        data->buffers.push_back(std::move(buffer));
+    }
+    return data;
+}
+
+// every matcher is checked (the text view is built on demand, only when a text matcher needs it)
+static Body AllMatchers(uint64& bytes)
+{
+    auto data = CreateData();
+    if (!data)
+        return Fail("fail to create the matchers");
+    bytes = static_cast<uint64>(BUFFERS_COUNT) * BUFFER_SIZE;
+    return [data]() {
+        uint64 sum = 0;
+        for (const auto& buffer : data->buffers) {
+            TextParser text(buffer);
+            for (auto index = 0U; index < data->matchers.size(); index++)
+                if (data->matchers[index]->Match(buffer, text))
+                    sum += index + 1;
+        }
+        return sum;
+    };
+}
+
+// only the matchers that can match the first byte of the buffer (the way the type plugins are indexed)
+static Body IndexedMatchers(uint64& bytes)
+{
+    auto data = CreateData();
+    if (!data)
+        return Fail("fail to create the matchers");
+    auto index = std::make_shared<std::array<std::vector<uint32>, 256>>();
+    for (auto id = 0U; id < data->matchers.size(); id++) {
+        uint8 value;
+        if (data->matchers[id]->GetFirstByte(value)) {
+            (*index)[value].push_back(id);
+        } else {
+            for (auto& list : *index)
+                list.push_back(id);
+        }
+    }
+    bytes = static_cast<uint64>(BUFFERS_COUNT) * BUFFER_SIZE;
+    return [data, index]() {
+        uint64 sum = 0;
+        for (const auto& buffer : data->buffers) {
+            TextParser text(buffer);
+            for (auto id : (*index)[buffer[0]])
+                if (data->matchers[id]->Match(buffer, text))
+                    sum += id + 1;
+        }
+        return sum;
+    };
+}
+
+void RegisterMatchers()
+{
+    Add("Matchers", "Identify.AllMatchers", AllMatchers);
+    Add("Matchers", "Identify.IndexedByFirstByte", IndexedMatchers);
+}
+} // namespace GView::Bench
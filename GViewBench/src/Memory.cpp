@@ -0,0 +1,82 @@
+#include "Bench.hpp"
+
+#if defined(BUILD_FOR_WINDOWS)
+#    include <Windows.h>
+#    include <psapi.h>
+#    undef GetObject
+#elif defined(BUILD_FOR_OSX)
+#    include <mach/mach.h>
+#else
+#    include <fstream>
+#    include <string>
+#endif
+
+namespace GView::Bench::Memory
+{
+#if defined(BUILD_FOR_WINDOWS)
+void ResetPeak()
+{
+    // the peak working set of a process can not be reset
+}
+uint64 GetCurrent()
+{
+    PROCESS_MEMORY_COUNTERS counters{};
+    CHECK(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)), 0, "");
+    return counters.WorkingSetSize;
+}
+uint64 GetPeak()
+{
+    PROCESS_MEMORY_COUNTERS counters{};
+    CHECK(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)), 0, "");
+    return counters.PeakWorkingSetSize;
+}
+#elif defined(BUILD_FOR_OSX)
+static bool GetTaskInfo(mach_task_basic_info& info)
+{
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    return task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS;
+}
+void ResetPeak()
+{
+    // the peak resident size of a task can not be reset
+}
+uint64 GetCurrent()
+{
+    mach_task_basic_info info{};
+    CHECK(GetTaskInfo(info), 0, "");
+    return info.resident_size;
+}
+uint64 GetPeak()
+{
+    mach_task_basic_info info{};
+    CHECK(GetTaskInfo(info), 0, "");
+    return info.resident_size_max;
+}
+#else
+// value (in kB) of a field from /proc/self/status
+static uint64 ReadStatus(std::string_view field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field) && (line.size() > field.size()) && (line[field.size()] == ':'))
+            return std::stoull(line.substr(field.size() + 1)) * 1024;
+    }
+    return 0;
+}
+void ResetPeak()
+{
+    // writing 5 in clear_refs resets the peak resident set size (VmHWM) to the current one
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+}
+uint64 GetCurrent()
+{
+    return ReadStatus("VmRSS");
+}
+uint64 GetPeak()
+{
+    return ReadStatus("VmHWM");
+}
+#endif
+} // namespace GView::Bench::Memory
@@ -0,0 +1,37 @@
+#include "Bench.hpp"
+
+namespace GView::Bench
+{
+// finds all the matches (the way the find dialog walks a buffer) - Matcher::Match returns the first capture group
+static Setup FindAll(std::string_view file, std::string_view expression, bool isCaseSensitive)
+{
+    return [=](uint64& bytes) -> Body {
+        auto content = Corpus::Get(file);
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        auto matcher = std::make_shared<Regex::Matcher>();
+        if (!matcher->Init(expression, false, isCaseSensitive))
+            return Fail("invalid expression");
+        bytes = content.GetLength();
+        return [content, matcher]() {
+            uint64 count = 0, start = 0, end = 0;
+            size_t offset = 0;
+            while (offset < content.GetLength()) {
+                if (!matcher->Match(BufferView(content.GetData() + offset, content.GetLength() - offset), start, end))
+                    break;
+                count++;
+                offset += std::max<uint64>(end, start + 1);
+            }
+            return count;
+        };
+    };
+}
+
+void RegisterRegex()
+{
+    Add("Regex", "Literal.Rare", FindAll("text.txt", "(address 9999[0-9])", true));
+    Add("Regex", "Literal.Frequent", FindAll("text.txt", "(entropy)", true));
+    Add("Regex", "CaseInsensitive", FindAll("text.txt", "(GVIEW [a-z]+ [0-9]+)", false));
+    Add("Regex", "CharacterClass.Binary", FindAll("binary.bin", "([a-z]{16,})", true));
+}
+} // namespace GView::Bench
@@ -0,0 +1,144 @@
+#include "Bench.hpp"
+
+#include <map>
+
+namespace GView::Bench
+{
+using namespace GView::Utils;
+
+// same number of items as the generated inputs (types/<format>_<N>.<extension>)
+constexpr uint32 ITEMS[]    = { 100, 1000, 10000 };
+constexpr uint32 CACHE_SIZE = 0xA00000;
+// size of the buffer that GView gives to the 'Validate' export when it identifies a file
+constexpr uint32 VALIDATE_BUFFER_SIZE = 0x8800;
+
+struct TypeFormat {
+    std::string_view plugin;
+    std::string_view prefix;
+    std::string_view extension;
+    bool headless; // has an 'Analyze' export (the JS tokens and blocks are built by the LexicalViewer => only with a window)
+};
+
+// the formats with a generator (GViewBench/generator/TypesGenerator.cpp)
+constexpr TypeFormat FORMATS[] = {
+    { "PE", "pe", ".exe", true },    { "ELF", "elf", ".so", true }, { "PCAP", "pcap", ".pcap", true }, { "ZIP", "zip", ".zip", true },
+    { "CSV", "csv", ".csv", true },  { "JS", "js", ".js", false },  { "ISO", "iso", ".iso", true },
+};
+
+// the exports of a type plugin (loaded the same way as GView does it - Types/lib<name>.tpl next to the executable)
+struct TypePlugin {
+    bool (*fnValidate)(const AppCUI::Utils::BufferView& buf, const std::string_view& extension){ nullptr };
+    TypeInterface* (*fnCreateInstance)(){ nullptr };
+    bool (*fnAnalyze)(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output){ nullptr };
+};
+
+static const TypePlugin* LoadTypePlugin(std::string_view name)
+{
+    static std::map<std::string_view, TypePlugin> plugins;
+    auto it = plugins.find(name);
+    if (it != plugins.end())
+        return it->second.fnValidate ? &it->second : nullptr;
+
+    auto& plugin = plugins[name];
+    AppCUI::OS::Library lib;
+    auto path = AppCUI::OS::GetCurrentApplicationPath();
+    path.remove_filename();
+    path /= "Types";
+    path /= "lib";
+    path += name;
+    path += ".tpl";
+    CHECK(lib.Load(path), nullptr, "Unable to load: %s", path.generic_string().c_str());
+    plugin.fnValidate       = lib.GetFunction<decltype(plugin.fnValidate)>("Validate");
+    plugin.fnCreateInstance = lib.GetFunction<decltype(plugin.fnCreateInstance)>("CreateInstance");
+    plugin.fnAnalyze        = lib.GetFunction<decltype(plugin.fnAnalyze)>("Analyze"); // optional
+    if (!plugin.fnCreateInstance)
+        plugin.fnValidate = nullptr;
+    CHECK(plugin.fnValidate, nullptr, "Missing 'Validate' or 'CreateInstance' export in %s", path.generic_string().c_str());
+    return &plugin;
+}
+
+static std::string GetInputName(const TypeFormat& format, uint32 count)
+{
+    LocalString<64> name;
+    name.Format("types/%.*s_%u%.*s", (int) format.prefix.size(), format.prefix.data(), count, (int) format.extension.size(), format.extension.data());
+    return std::string(name.GetText());
+}
+
+static Setup Validate(const TypeFormat& format, uint32 count)
+{
+    return [=](uint64& bytes) -> Body {
+        auto plugin = LoadTypePlugin(format.plugin);
+        if (!plugin)
+            return Fail("unable to load the type plugin");
+        auto content = Corpus::Get(GetInputName(format, count));
+        if (!content.IsValid())
+            return Fail("fail to load the corpus file");
+        BufferView buf(content.GetData(), std::min<size_t>(content.GetLength(), VALIDATE_BUFFER_SIZE));
+        if (!plugin->fnValidate(buf, format.extension))
+            return Fail("the input is not recognized by the type plugin");
+        bytes = buf.GetLength();
+        return [plugin, buf, extension = format.extension]() -> uint64 { return plugin->fnValidate(buf, extension) ? 1 : 0; };
+    };
+}
+
+static Setup CreateInstance(const TypeFormat& format)
+{
+    return [=](uint64& bytes) -> Body {
+        auto plugin = LoadTypePlugin(format.plugin);
+        if (!plugin)
+            return Fail("unable to load the type plugin");
+        bytes = 0;
+        return [plugin]() -> uint64 {
+            std::unique_ptr<TypeInterface> contentType(plugin->fnCreateInstance());
+            return contentType ? 1 : 0;
+        };
+    };
+}
+
+// opens the file (like GView does) and parses it via the 'Analyze' export => the time also includes the JSON
+// serialization of the parsed model (small compared with the parsing)
+static Setup Update(const TypeFormat& format, uint32 count)
+{
+    return [=](uint64& bytes) -> Body {
+        auto plugin = LoadTypePlugin(format.plugin);
+        if (!plugin)
+            return Fail("unable to load the type plugin");
+        if (!plugin->fnAnalyze)
+            return Fail("the type plugin can only be parsed with a window (no 'Analyze' export)");
+        const auto path = Corpus::GetPath(GetInputName(format, count));
+        std::error_code ec;
+        bytes = std::filesystem::file_size(path, ec);
+        if (ec)
+            return Fail("fail to load the corpus file");
+
+        auto parse = [plugin, path]() -> uint64 {
+            DataCache cache;
+            CHECK(cache.Init(path, CACHE_SIZE, false), 0, "");
+            std::unique_ptr<TypeInterface> contentType(plugin->fnCreateInstance());
+            CHECK(contentType, 0, "");
+            GView::Object obj(GView::Object::Type::File, std::move(cache), contentType.get(), path.filename().u16string(), path.u16string(), 0);
+            JSONWriter output;
+            output.BeginObject();
+            CHECK(plugin->fnAnalyze(&obj, &output), 0, "");
+            output.Close();
+            return output.GetText().size();
+        };
+        if (parse() == 0)
+            return Fail("the type plugin could not parse the input");
+        return parse;
+    };
+}
+
+void RegisterTypes()
+{
+    LocalString<64> name;
+    for (const auto& format : FORMATS) {
+        Add("Types", name.Format("%.*s.CreateInstance", (int) format.plugin.size(), format.plugin.data()), CreateInstance(format));
+        for (auto count : ITEMS) {
+            Add("Types", name.Format("%.*s.Validate.N=%u", (int) format.plugin.size(), format.plugin.data(), count), Validate(format, count));
+            if (format.headless)
+                Add("Types", name.Format("%.*s.Update.N=%u", (int) format.plugin.size(), format.plugin.data(), count), Update(format, count));
+        }
+    }
+}
+} // namespace GView::Bench
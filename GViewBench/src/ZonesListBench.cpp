@@ -0,0 +1,52 @@
+#include "Bench.hpp"
+
+namespace GView::Bench
+{
+using namespace AppCUI::Graphics;
+using namespace GView::Utils;
+
+// a large PE / ELF / PCAP file has thousands of zones (sections, resources, packets)
+constexpr uint32 ZONES_COUNT = 2000;
+constexpr uint32 LOOKUPS     = 10000;
+
+struct ZonesData {
+    ZonesList zones;
+    std::vector<uint64> offsets;
+};
+
+static Setup OffsetToZone(bool sequential)
+{
+    return [=](uint64& bytes) -> Body {
+        auto data = std::make_shared<ZonesData>();
+        Random rnd(0x20AE0001);
+        uint64 offset = 0;
+        LocalString<32> name;
+        for (auto index = 0U; index < ZONES_COUNT; index++) {
+            auto size = 16 + rnd.Next(0x2000);
+            data->zones.Add(offset, offset + size - 1, ColorPair{ Color::White, Color::DarkBlue }, name.Format("Zone_%u", index));
+            // gaps between the zones (offsets that are not in any zone)
+            offset += size + (rnd.Next(4) == 0 ? rnd.Next(0x100) : 0);
+        }
+        data->zones.SetCache({ 0, offset });
+        data->offsets.resize(LOOKUPS);
+        for (auto index = 0U; index < LOOKUPS; index++)
+            data->offsets[index] = sequential ? index * (offset / LOOKUPS) : rnd.Next(offset);
+        bytes = 0;
+        return [data]() {
+            uint64 sum = 0;
+            for (auto position : data->offsets) {
+                auto zone = data->zones.OffsetToZone(position);
+                if (zone.has_value())
+                    sum += zone->interval.low;
+            }
+            return sum;
+        };
+    };
+}
+
+void RegisterZonesList()
+{
+    Add("ZonesList", "OffsetToZone.Sequential", OffsetToZone(true));
+    Add("ZonesList", "OffsetToZone.Random", OffsetToZone(false));
+}
+} // namespace GView::Bench
@@ -0,0 +1,216 @@
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+using namespace GView::Bench;
+
+constexpr std::string_view help = R"HELP(
+Use: GViewBench <options>
+Where <options> are:
+   --list               Shows the available benchmarks (group.name)
+   --filter <text>      Only runs the benchmarks that contain <text> in their group.name (can be used multiple times)
+   --samples <count>    Number of timed samples for each benchmark (default: 7)
+   --min-time <ms>      Minimum duration of one sample in milliseconds (default: 50)
+   --corpus <folder>    Folder with the corpus files (default: the one generated at build time)
+   --json               Outputs one JSON object (per line) for each benchmark
+)HELP";
+
+struct Options {
+    std::vector<std::string_view> filters;
+    std::filesystem::path corpus{ GVIEWBENCH_CORPUS_DIR };
+    uint32 samples{ 7 };
+    uint32 minTime{ 50 };
+    bool json{ false };
+    bool list{ false };
+};
+
+struct Result {
+    uint64 bytes; // for one iteration
+    uint64 iterations;
+    uint64 minimum, median, maximum; // nanoseconds for one iteration
+    uint64 checksum;
+    uint64 peakMemory;   // peak resident memory of the process (setup + all iterations)
+    uint64 memoryGrowth; // peak resident memory - resident memory before the setup
+};
+
+volatile uint64 sink = 0;
+
+bool ParseOptions(int argc, const char** argv, Options& options)
+{
+    for (int index = 1; index < argc; index++) {
+        std::string_view arg = argv[index];
+        auto hasValue        = index + 1 < argc;
+        if (arg == "--list") {
+            options.list = true;
+        } else if (arg == "--json") {
+            options.json = true;
+        } else if ((arg == "--filter") && hasValue) {
+            options.filters.emplace_back(argv[++index]);
+        } else if ((arg == "--corpus") && hasValue) {
+            options.corpus = argv[++index];
+        } else if ((arg == "--samples") && hasValue) {
+            auto value = AppCUI::Utils::Number::ToUInt32(argv[++index]);
+            CHECK(value.has_value() && (value.value() > 0), false, "Invalid number of samples: %s", argv[index]);
+            options.samples = value.value();
+        } else if ((arg == "--min-time") && hasValue) {
+            auto value = AppCUI::Utils::Number::ToUInt32(argv[++index]);
+            CHECK(value.has_value() && (value.value() > 0), false, "Invalid minimum time: %s", argv[index]);
+            options.minTime = value.value();
+        } else {
+            std::cout << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsSelected(const Options& options, const Benchmark& b)
+{
+    if (options.filters.empty())
+        return true;
+    auto fullName = b.group + "." + b.name;
+    for (auto filter : options.filters)
+        if (fullName.find(filter) != std::string::npos)
+            return true;
+    return false;
+}
+
+uint64 TimeIterations(const Body& body, uint64 iterations)
+{
+    uint64 sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64 index = 0; index < iterations; index++)
+        sum += body();
+    auto duration = std::chrono::steady_clock::now() - start;
+    sink          = sink + sum;
+    return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+Result Run(const Body& body, const Options& options)
+{
+    Result result{};
+    // the first call is a warm-up (caches, lazy allocations) - its value is the checksum of the benchmark
+    result.checksum = body();
+
+    // calibration: the number of iterations that takes at least "minTime" ms
+    const uint64 minTime = static_cast<uint64>(options.minTime) * 1000000ULL;
+    uint64 iterations    = 1;
+    while (true) {
+        auto duration = TimeIterations(body, iterations);
+        if (duration >= minTime)
+            break;
+        auto estimate = duration > 0 ? (minTime * 11 / 10) * iterations / duration : iterations * 10;
+        iterations    = std::clamp<uint64>(estimate, iterations + 1, iterations * 10);
+    }
+
+    std::vector<uint64> samples;
+    samples.reserve(options.samples);
+    for (auto index = 0U; index < options.samples; index++)
+        samples.push_back(TimeIterations(body, iterations) / iterations);
+    std::sort(samples.begin(), samples.end());
+
+    result.iterations = iterations;
+    result.minimum    = samples.front();
+    result.median     = samples[samples.size() / 2];
+    result.maximum    = samples.back();
+    return result;
+}
+
+// MB/s (1 MB = 1000000 bytes)
+double Throughput(uint64 bytes, uint64 nanoseconds)
+{
+    return nanoseconds > 0 ? static_cast<double>(bytes) * 1000.0 / static_cast<double>(nanoseconds) : 0.0;
+}
+
+void PrintResult(const Options& options, const Benchmark& b, const Result* result, std::string_view error)
+{
+    if (options.json) {
+        GView::Utils::JSONWriter output;
+        output.BeginObject();
+        output.AddString("group", b.group);
+        output.AddString("name", b.name);
+        if (result) {
+            output.AddNumber("bytes", result->bytes);
+            output.AddNumber("iterations", result->iterations);
+            output.AddNumber("samples", options.samples);
+            output.AddNumber("minNs", result->minimum);
+            output.AddNumber("medianNs", result->median);
+            output.AddNumber("maxNs", result->maximum);
+            // bytes per second (integer => no locale / precision issues for the tools that read the output)
+            output.AddNumber("bytesPerSecond", static_cast<uint64>(Throughput(result->bytes, result->median) * 1000000.0));
+            output.AddNumber("checksum", result->checksum);
+            output.AddNumber("peakRSS", result->peakMemory);
+            output.AddNumber("peakRSSGrowth", result->memoryGrowth);
+        } else {
+            output.AddString("error", error);
+        }
+        output.EndObject();
+        std::cout << output.GetText() << std::endl;
+        return;
+    }
+
+    LocalString<256> line;
+    if (result) {
+        line.Format("%-12s %-36s %14llu ns (min: %llu, max: %llu)", b.group.c_str(), b.name.c_str(), result->median, result->minimum, result->maximum);
+        if (result->bytes > 0)
+            line.AddFormat(" %10.1f MB/s", Throughput(result->bytes, result->median));
+        line.AddFormat(" peak RSS: %.1f MB (+%.1f MB)", result->peakMemory / 1048576.0, result->memoryGrowth / 1048576.0);
+    } else {
+        line.Format("%-12s %-36s skipped: %s", b.group.c_str(), b.name.c_str(), std::string(error).c_str());
+    }
+    std::cout << line.GetText() << std::endl;
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::cout << help << std::endl;
+        return 1;
+    }
+
+    RegisterDataCache();
+    RegisterBytePattern();
+    RegisterHashes();
+    RegisterEntropy();
+    RegisterEncoding();
+    RegisterRegex();
+    RegisterZonesList();
+    RegisterMatchers();
+    RegisterDecoding();
+    RegisterTypes();
+
+    if (options.list) {
+        for (const auto& b : GetBenchmarks())
+            std::cout << b.group << "." << b.name << std::endl;
+        return 0;
+    }
+
+    if (!Corpus::Load(options.corpus)) {
+        std::cout << "Corpus folder not found: " << options.corpus.string() << std::endl;
+        return 1;
+    }
+
+    auto failed = 0U;
+    for (const auto& b : GetBenchmarks()) {
+        if (!IsSelected(options, b))
+            continue;
+        Memory::ResetPeak();
+        const auto memory = Memory::GetCurrent();
+        uint64 bytes      = 0;
+        auto body         = b.setup(bytes);
+        if (!body) {
+            PrintResult(options, b, nullptr, GetLastError());
+            failed++;
+            continue;
+        }
+        auto result         = Run(body, options);
+        result.bytes        = bytes;
+        result.peakMemory   = Memory::GetPeak();
+        result.memoryGrowth = result.peakMemory > memory ? result.peakMemory - memory : 0;
+        PrintResult(options, b, &result, {});
+    }
+    return failed == 0 ? 0 : 1;
+}
@@ -72,6 +72,7 @@ namespace Utils
 {
     constexpr uint64 INVALID_OFFSET       = 0xFFFFFFFFFFFFFFFFULL;
     constexpr int INVALID_SELECTION_INDEX = -1;
+    constexpr uint32 DEFAULT_CACHE_PAGE_SIZE = 0x10000; // 64 K
 
     class CORE_EXPORT ErrorList
     {
@@ -94,24 +95,95 @@ namespace Utils
 
         void PopulateListView(AppCUI::Utils::Reference<AppCUI::Controls::ListView> listView) const;
     };
+    // builds a compact (single line) JSON text; keys are ignored for values added directly in an array
+    class CORE_EXPORT JSONWriter
+    {
+        void* data;
+
+      public:
+        JSONWriter();
+        ~JSONWriter();
+        JSONWriter(const JSONWriter&)            = delete;
+        JSONWriter& operator=(const JSONWriter&) = delete;
+
+        void Clear();
+        bool BeginObject(std::string_view key = {});
+        bool EndObject();
+        bool BeginArray(std::string_view key = {});
+        bool EndArray();
+
+        bool AddString(std::string_view key, std::string_view value);
+        bool AddString(std::string_view key, std::u16string_view value);
+        bool AddNumber(std::string_view key, uint64 value);
+        bool AddSignedNumber(std::string_view key, int64 value);
+        bool AddBool(std::string_view key, bool value);
+        bool AddNull(std::string_view key);
+
+        // number of objects/arrays that are still open
+        uint32 GetLevel() const;
+        // closes the objects/arrays that were opened after "level" was reached (useful after a partial output)
+        void Close(uint32 level = 0);
+
+        std::string_view GetText() const;
+    };
+    struct DataCacheStats {
+        uint64 getCalls;
+        uint64 hits;        // requests served without waiting for a read (memory, cached pages, read-ahead buffers)
+        uint64 misses;      // requests that had to read from the data object
+        uint64 refills;     // read operations on the data object (including the background read-ahead)
+        uint64 bytesRead;   // bytes read from the data object
+        uint64 bytesCopied; // bytes copied by CopyToBuffer / Copy<T>
+        uint64 readTime;    // time spent reading from the data object (microseconds)
+    };
+    struct DataCacheSource;  // shared, thread-safe access to the underlying data object (defined in DataCache.cpp)
+    struct DataCachePatches; // copy-on-write overlay with the modified bytes (defined in DataCache.cpp)
     class CORE_EXPORT DataCache
     {
-        AppCUI::OS::DataObject* fileObj;
-        uint64 fileSize, start, end, currentPos;
-        uint8* cache;
+        std::shared_ptr<DataCacheSource> source;
+        std::shared_ptr<const uint8> memory; // entire content is directly addressable (memory mapped file or adopted buffer) => no cache
+        uint64 fileSize, start, end, currentPos; // [start, end) - last used run of consecutive pages
+        uint8* cache;                            // page slots
+        const uint8* window;                     // data for offset "start"
+        void* pages;                             // page table (LRU)
+        void* readAhead;                         // background prefetch for sequential scans
+        bool readAheadEnabled;                   // SetReadAhead (also applied to the readers)
+        std::shared_ptr<DataCachePatches> patches;
+        uint64 patchesBase; // offset of the data in "patches" (a range shares the overlay of its parent)
+        Buffer patched; // original data + patches for the last request that touched a modified range
         uint32 cacheSize;
+        DataCacheStats stats;
 
         bool CopyObject(void* buffer, uint64 offset, uint32 requestedSize);
+        bool ReadPages(uint64 firstPage, uint32 count, uint32 slot);
+        uint32 LoadPages(uint64 firstPage, uint32 count);
+        BufferView GetSequential(uint64 offset, uint32 requestedSize);
+        BufferView GetOriginal(uint64 offset, uint32 requestedSize, bool failIfRequestedSizeCanNotBeRead);
+        BufferView GetPatched(uint64 offset, BufferView original);
+        bool InitMemory(std::shared_ptr<const uint8> content, uint64 size, uint32 cacheSize);
+        bool InitPages(std::shared_ptr<DataCacheSource> src, uint64 size, uint32 cacheSize, uint32 pageSize);
 
       public:
         DataCache();
         DataCache(DataCache&& obj);
         ~DataCache();
 
-        bool Init(std::unique_ptr<AppCUI::OS::DataObject> file, uint32 cacheSize);
+        bool Init(std::unique_ptr<AppCUI::OS::DataObject> file, uint32 cacheSize, uint32 pageSize = DEFAULT_CACHE_PAGE_SIZE);
+        bool Init(const std::filesystem::path& path, uint32 cacheSize, bool useMemoryMapping, uint32 pageSize = DEFAULT_CACHE_PAGE_SIZE);
+        bool Init(Buffer&& buffer, uint32 cacheSize); // takes ownership of the buffer (no copy, no cache)
+        // [offset, offset+size) of another cache (the content is shared, not copied - it stays valid after "parent" is closed)
+        // the patches are shared with the parent (the modified bytes of the parent are visible in the range and the other way around)
+        bool Init(const DataCache& parent, uint64 offset, uint64 size, uint32 cacheSize, uint32 pageSize = DEFAULT_CACHE_PAGE_SIZE);
+
+        // independent reader (own cursor, window and pages) over the same content (file handle / mapping / buffer are shared)
+        // it only uses data that does not change after Init, so it can be called from any thread; the returned object
+        // must be used by one thread at a time (create one reader per worker). The reader uses read-ahead only if it is
+        // enabled for this cache and "readAhead" is true (workers that do not scan a contiguous range should pass false)
+        DataCache CreateReader(uint32 readerCacheSize = 0, bool readAhead = true) const;
         BufferView Get(uint64 offset, uint32 requestedSize, bool failIfRequestedSizeCanNotBeRead);
         inline BufferView GetEntireFile()
         {
+            if ((memory) && (!HasPatches()))
+                return BufferView(memory.get(), (size_t) fileSize);
             return fileSize < 0xFFFFFFFF ? Get(0, (uint32) fileSize, true) : BufferView();
         }
 
@@ -120,10 +192,11 @@ namespace Utils
         {
             return CopyToBuffer(0, (uint32) fileSize, failIfRequestedSizeCanNotBeRead);
         }
+        // last window returned by Get() (the whole content for memory mapped files and buffers)
         inline uint8 GetFromCache(uint64 offset, uint8 defaultValue = 0) const
         {
             if ((offset >= start) && (offset < end))
-                return cache[offset - start];
+                return window[offset - start];
             return defaultValue;
         }
         inline uint32 GetCacheSize() const
@@ -135,6 +208,10 @@ namespace Utils
         {
             return fileSize;
         }
+        inline bool IsMemoryMapped() const
+        {
+            return memory != nullptr;
+        }
         inline uint64 GetCurrentPos() const
         {
             return currentPos;
@@ -144,6 +221,13 @@ namespace Utils
             currentPos = value;
         }
 
+        DataCacheStats GetStatistics() const;
+        void LogStatistics(std::string_view name) const;
+
+        // when enabled (default) forward sequential Get() calls are detected and the
+        // next window is read in background while the current one is being processed
+        void SetReadAhead(bool enabled);
+
         template <typename T>
         inline bool Copy(uint64 offset, T& object)
         {
@@ -151,6 +235,47 @@ namespace Utils
         }
 
         bool WriteTo(Reference<AppCUI::OS::DataObject> output, uint64 offset, uint32 size);
+
+        // in-place edits: the modified bytes are kept in a sorted list of intervals (the original data is never changed or copied)
+        // and applied over the original content by Get() / CopyToBuffer() / Copy<T>. The overlay is shared with the readers
+        // created with CreateReader() and with the ranges opened over this cache. Edits can not change the size of the data.
+        bool Patch(uint64 offset, BufferView data);
+        void ClearPatches(); // (for a range only the modified bytes of the range are removed)
+        bool HasPatches() const;
+        uint64 GetPatchedSize() const;    // number of modified bytes
+        uint64 GetPatchesVersion() const; // changes with each Patch / ClearPatches (the data computed from the content is outdated)
+        // writes the original content and the patches to "path" (streamed, one cache window at a time)
+        bool SaveAs(const std::filesystem::path& path);
+
+        // calls "callback(uint64 chunkOffset, BufferView chunk)" for consecutive views (no copy) that cover [offset, offset+size)
+        // (clamped to the size of the data). A chunk has at most "chunkSize" bytes (0 means the cache size) and, except for the first
+        // one, starts "overlap" bytes before the end of the previous one - so a pattern of up to overlap+1 bytes is never split.
+        // Chunk sizes and overlap are multiples of "alignment" (relative to "offset").
+        // Returns false if a read fails or if the callback returns false (to stop the iteration).
+        template <typename Fn>
+        bool ForEachChunk(uint64 offset, uint64 size, uint32 chunkSize, uint32 overlap, Fn&& callback, uint32 alignment = 1)
+        {
+            alignment = std::max<uint32>(alignment, 1);
+            if ((chunkSize == 0) || (chunkSize > cacheSize))
+                chunkSize = cacheSize;
+            chunkSize -= chunkSize % alignment;
+            overlap = ((overlap + alignment - 1) / alignment) * alignment;
+            CHECK(overlap < chunkSize, false, "Overlap (%u) must be smaller than the chunk size (%u)", overlap, chunkSize);
+            if (offset >= fileSize)
+                return true;
+            const auto last = offset + std::min<uint64>(size, fileSize - offset);
+            while (offset < last) {
+                const auto sz = static_cast<uint32>(std::min<uint64>(chunkSize, last - offset));
+                const auto bv = Get(offset, sz, true);
+                CHECK(bv.IsValid(), false, "Fail to read %u bytes from offset %llu", sz, offset);
+                if (!callback(offset, bv))
+                    return false;
+                if (offset + sz >= last)
+                    break;
+                offset += sz - overlap;
+            }
+            return true;
+        }
     };
 
     enum class DemangleKind : uint8 {
@@ -201,6 +326,31 @@ namespace Utils
         std::optional<Zone> GetZone(uint32 index) const;
     };
 
+    // fixed length sequence of bytes, each one compared under a mask: "(value & mask) == (pattern & mask)" - EXACT for a byte, ANY
+    // for a wildcard and IGNORE_CASE for an ASCII letter in either case. Candidates are found with a vectorized compare of two of the
+    // rarest bytes of the pattern, Boyer-Moore-Horspool skips are used when the prefilter finds too many of them.
+    class CORE_EXPORT BytePattern
+    {
+        void* data;
+
+      public:
+        static constexpr uint8 EXACT       = 0xFF;
+        static constexpr uint8 ANY         = 0x00;
+        static constexpr uint8 IGNORE_CASE = 0xDF;
+
+        BytePattern();
+        ~BytePattern();
+        BytePattern(const BytePattern&)            = delete;
+        BytePattern& operator=(const BytePattern&) = delete;
+
+        // "mask" is empty (all the bytes are EXACT) or has the same length as "pattern". "ignoreCase" => the ASCII letters compared
+        // as EXACT are compared as IGNORE_CASE. A pattern must have at least one byte that is not a wildcard.
+        bool Init(BufferView pattern, BufferView mask = {}, bool ignoreCase = false);
+        uint32 GetLength() const;
+        // first match in "buffer" that starts at or after "start"
+        bool Find(BufferView buffer, size_t start, size_t& position) const;
+    };
+
     struct CORE_EXPORT ObjectHighlightingZonesInterface {
         virtual uint32 GetObjectsZonesCount() const                    = 0;
         virtual std::optional<Zone> GetObjectsZone(uint32 index) const = 0;
@@ -311,6 +461,29 @@ namespace Hashes
         char hexDigest[ResultBytesLength * 2];
     };
 
+    // kernels used by CRC16, CRC32 and CRC64 (all of them give the same values)
+    enum class CRCImplementation : uint8 {
+        Auto,              // the fastest one supported by the CPU
+        Table,             // one byte per step
+        Slicing,           // 16 bytes (CRC32) / 8 bytes (CRC16, CRC64) per step
+        CarrylessMultiply, // folding with PCLMULQDQ (x86-64) or PMULL (ARM64) - the tail is processed with the slicing tables
+    };
+    // returns false if the CPU does not support the implementation (the current one is kept)
+    CORE_EXPORT bool SetCRCImplementation(CRCImplementation implementation);
+    CORE_EXPORT CRCImplementation GetCRCImplementation();
+
+    // kernels used by Adler32 (all of them give the same values)
+    enum class Adler32Implementation : uint8 {
+        Auto, // the fastest one supported by the CPU
+        Scalar,
+        SSSE3, // x86-64
+        AVX2,  // x86-64
+        NEON,  // ARM64
+    };
+    // returns false if the CPU does not support the implementation (the current one is kept)
+    CORE_EXPORT bool SetAdler32Implementation(Adler32Implementation implementation);
+    CORE_EXPORT Adler32Implementation GetAdler32Implementation();
+
     enum class OpenSSLHashKind : uint8 {
         Md5,
         Blake2s256,
@@ -350,6 +523,49 @@ namespace Hashes
       private:
         char hexDigest[(sizeof(hash) / sizeof(hash[0])) * 2];
     };
+
+    // SHA-256 digests of the fixed size blocks of a content, combined in a binary hash tree (Merkle tree). Once computed, equality
+    // and change queries over ranges are answered from the digests alone (the content is not read again).
+    class CORE_EXPORT BlockIndex
+    {
+        void* data;
+
+      public:
+        static constexpr uint32 DEFAULT_BLOCK_SIZE = 0x10000;
+        static constexpr uint32 DIGEST_SIZE        = 32;
+        using Digest                               = std::array<uint8, DIGEST_SIZE>;
+
+        BlockIndex();
+        ~BlockIndex();
+        BlockIndex(const BlockIndex&)            = delete;
+        BlockIndex& operator=(const BlockIndex&) = delete;
+
+        // starts computing the digests in background (on a reader created from "cache"). If "indexFile" is given, the index saved
+        // there by a previous build is loaded as the previous version of the content and it is replaced when the new one is complete.
+        bool Build(const Utils::DataCache& cache, uint32 blockSize = DEFAULT_BLOCK_SIZE, const std::filesystem::path& indexFile = {});
+        void Cancel();
+        bool Wait(); // true if the index is complete
+        bool IsReady() const;
+        uint64 GetProcessedBlocks() const;
+
+        uint32 GetBlockSize() const;
+        uint64 GetBlocksCount() const;
+        uint64 GetSize() const;
+        bool GetBlockDigest(uint64 block, Digest& digest) const; // available as soon as the block is processed
+        bool GetRootDigest(Digest& digest) const;
+
+        // compares [offset, offset+size) with [otherOffset, otherOffset+size) of "other" (it can be this index). std::nullopt means
+        // that the digests are not enough: an index is not ready, the ranges have different positions relative to the blocks or
+        // they also contain parts of blocks (and all the whole blocks are identical)
+        std::optional<bool> AreRangesEqual(uint64 offset, const BlockIndex& other, uint64 otherOffset, uint64 size) const;
+        // bytes (at most "size") of the identical whole blocks that start at "offset" and "otherOffset" (0 if one of them is not the
+        // start of a block)
+        uint64 GetIdenticalSize(uint64 offset, const BlockIndex& other, uint64 otherOffset, uint64 size) const;
+        // blocks of this index that are not in "other" at the same position
+        bool GetDifferentBlocks(const BlockIndex& other, std::vector<uint64>& blocks) const;
+        // blocks that changed since the previous version of the content (the one saved in "indexFile"); false if there is none
+        bool GetChangedBlocks(std::vector<uint64>& blocks) const;
+    };
 } // namespace Hashes
 
 namespace DigitalSignature
@@ -804,8 +1020,48 @@ namespace Regex
 
 namespace Entropy
 {
+    using Histogram = std::array<uint64, 256>; // number of occurrences of each byte value
+
+    // adds the bytes of "buffer" to "histogram" (histograms of consecutive blocks can be summed)
+    CORE_EXPORT void UpdateHistogram(const BufferView& buffer, Histogram& histogram);
+    CORE_EXPORT double ShannonEntropy(const Histogram& histogram);
+    CORE_EXPORT double RenyiEntropy(const Histogram& histogram, double alpha);
+
     CORE_EXPORT double ShannonEntropy(const BufferView& buffer);
     CORE_EXPORT double RenyiEntropy(const BufferView& buffer, double alpha);
+
+    enum class RegionType : uint8 { Padding, Text, Code, Compressed, Encrypted, Data };
+
+    struct RegionStatistics {
+        uint64 size;
+        double shannon;        // bits per byte [0, 8]
+        double chiSquare;      // against the uniform distribution (255 degrees of freedom)
+        double printableRatio; // printable ASCII, tabs and new lines [0, 1]
+        double zeroRunRatio;   // bytes in runs of at least 4 zeros [0, 1]
+        double bigramEntropy;  // bits per pair of consecutive bytes [0, 16]
+        double codeScore;      // similarity of the byte distribution with the one of x86/x64 code [0, 1]
+    };
+
+    // Statistics of a region computed in one pass over its bytes (given in one or more consecutive parts)
+    class CORE_EXPORT RegionClassifier
+    {
+        void* data;
+
+      public:
+        RegionClassifier();
+        ~RegionClassifier();
+        RegionClassifier(const RegionClassifier&)            = delete;
+        RegionClassifier& operator=(const RegionClassifier&) = delete;
+
+        void Reset(); // starts a new region
+        void Update(const BufferView& buffer);
+        RegionStatistics GetStatistics() const;
+        RegionType GetRegionType() const;
+
+        static RegionType Classify(const RegionStatistics& statistics);
+        static RegionType Classify(const BufferView& buffer, RegionStatistics& statistics);
+        static std::string_view GetRegionTypeName(RegionType type);
+    };
 } // namespace Entropy
 
 /*
@@ -827,6 +1083,8 @@ class CORE_EXPORT Object
     AppCUI::Utils::UnicodeStringBuilder filePath;
     uint32 PID;
     Type objectType;
+    std::unique_ptr<Hashes::BlockIndex> blockIndex; // declared after "cache" => stopped before the cache is destroyed
+    uint64 blockIndexPatchesVersion{ 0 };           // patches of the cache when the index was built
 
   public:
     Object(Type objType, Utils::DataCache&& dataCache, TypeInterface* contType, ConstString objName, ConstString objFilePath, uint32 pid)
@@ -864,6 +1122,9 @@ class CORE_EXPORT Object
     {
         return objectType;
     }
+    // digests of the blocks of the content - computed in background the first time they are requested and again after the content
+    // is patched. If "useIndexFile" is set, the index of an unpatched file is also saved next to it (<file>.blocks.cache)
+    Hashes::BlockIndex& GetBlockIndex(bool useIndexFile);
 };
 
 namespace View
@@ -1506,6 +1767,14 @@ namespace App
     enum class OpenMethod { FirstMatch, BestMatch, Select, ForceType };
     bool CORE_EXPORT Init();
     void CORE_EXPORT Run();
+    // loads the settings and the type plugins without any UI (to be used with IdentifyFile)
+    bool CORE_EXPORT InitHeadless();
+    // first matching type plugin for a file, without any UI (thread safe once InitHeadless succeeded)
+    // returns false if the file can not be read; "typeName" is empty if no type plugin matched
+    bool CORE_EXPORT IdentifyFile(const std::filesystem::path& path, std::string_view& typeName);
+    // identifies a file and (if its type plugin exports 'Analyze') writes the parsed model as a JSON object in "output"
+    // thread safe once InitHeadless succeeded; returns false if the file can not be read or parsed ("output" contains an "error" field)
+    bool CORE_EXPORT AnalyzeFile(const std::filesystem::path& path, GView::Utils::JSONWriter& output);
     bool CORE_EXPORT ResetConfiguration();
     void CORE_EXPORT OpenFile(const std::filesystem::path& path, OpenMethod method, std::string_view typeName = "", Reference<Window> parent = nullptr);
     void CORE_EXPORT OpenFile(const std::filesystem::path& path, std::string_view typeName, Reference<Window> parent = nullptr);
@@ -1516,6 +1785,24 @@ namespace App
           OpenMethod method,
           std::string_view typeName = "",
           Reference<Window> parent  = nullptr);
+    // same as above, but the buffer is adopted by the new object instead of being copied
+    void CORE_EXPORT OpenBuffer(
+          Buffer&& buf,
+          const ConstString& name,
+          const ConstString& path,
+          OpenMethod method,
+          std::string_view typeName = "",
+          Reference<Window> parent  = nullptr);
+    // opens [offset, offset+size) of an existing object as a new object (no copy)
+    void CORE_EXPORT OpenRange(
+          Reference<GView::Object> object,
+          uint64 offset,
+          uint64 size,
+          const ConstString& name,
+          const ConstString& path,
+          OpenMethod method,
+          std::string_view typeName = "",
+          Reference<Window> parent  = nullptr);
     Reference<GView::Object> CORE_EXPORT GetObject(uint32 index);
     uint32 CORE_EXPORT GetObjectsCount();
     std::string_view CORE_EXPORT GetTypePluginName(uint32 index);
@@ -5,13 +5,36 @@ using namespace GView::View;
 
 constexpr int32 BUTTON_ID_CLOSE = 1;
 constexpr int32 BUTTON_ID_GOTO  = 2;
+constexpr int32 BUTTON_ID_LOG   = 3;
 
-FileWindowProperties::FileWindowProperties(Reference<Tab> viewContainer) : Window("Properties", "d:c,w:78,h:24", WindowFlags::None)
+static void AddCacheStatistics(Reference<ListView> lv, const GView::Utils::DataCache& cache)
+{
+    const auto s = cache.GetStatistics();
+    LocalString<64> tmp;
+
+    lv->AddItem({ "Size", tmp.Format("%llu", cache.GetSize()) });
+    lv->AddItem({ "Cache size", tmp.Format("%u", cache.GetCacheSize()) });
+    lv->AddItem({ "Memory mapped", cache.IsMemoryMapped() ? "Yes" : "No" });
+    lv->AddItem({ "Get calls", tmp.Format("%llu", s.getCalls) });
+    lv->AddItem({ "Hits", tmp.Format("%llu", s.hits) });
+    lv->AddItem({ "Misses", tmp.Format("%llu", s.misses) });
+    lv->AddItem({ "Refills", tmp.Format("%llu", s.refills) });
+    lv->AddItem({ "Bytes read", tmp.Format("%llu", s.bytesRead) });
+    lv->AddItem({ "Bytes copied", tmp.Format("%llu", s.bytesCopied) });
+    lv->AddItem({ "Read time", tmp.Format("%llu.%03llu ms", s.readTime / 1000, s.readTime % 1000) });
+}
+
+FileWindowProperties::FileWindowProperties(Reference<Tab> viewContainer, Reference<GView::Object> _obj)
+    : Window("Properties", "d:c,w:78,h:24", WindowFlags::None), obj(_obj)
 {
     auto t = Factory::Tab::Create(this, "l:1,t:1,r:1,b:3", TabFlags::LeftTabs | TabFlags::TabsBar);
 
     Factory::TabPage::Create(t, "General");
 
+    auto tp_cache = Factory::TabPage::Create(t, "Cache");
+    auto lv       = Factory::ListView::Create(tp_cache, "d:c", { "n:Counter,a:l,w:16", "n:Value,a:l,w:40" }, ListViewFlags::None);
+    AddCacheStatistics(lv, obj->GetData());
+
     // process all view modes
     for (uint32 idx = 0; idx < viewContainer->GetChildrenCount(); idx++)
     {
@@ -23,8 +46,9 @@ FileWindowProperties::FileWindowProperties(Reference<Tab> viewContainer) : Windo
         }
     }
 
-    Factory::Button::Create(this, "&Close", "x:40%,y:22,a:b,w:12", BUTTON_ID_CLOSE);
-    Factory::Button::Create(this, "&Go To", "x:60%,y:22,a:b,w:12", BUTTON_ID_GOTO);
+    Factory::Button::Create(this, "&Close", "x:30%,y:22,a:b,w:12", BUTTON_ID_CLOSE);
+    Factory::Button::Create(this, "&Go To", "x:50%,y:22,a:b,w:12", BUTTON_ID_GOTO);
+    Factory::Button::Create(this, "&Log stats", "x:70%,y:22,a:b,w:12", BUTTON_ID_LOG);
 }
 bool FileWindowProperties::OnEvent(Reference<Control> control, Event eventType, int ID)
 {
@@ -43,6 +67,13 @@ bool FileWindowProperties::OnEvent(Reference<Control> control, Event eventType,
             this->Exit(Dialogs::Result::Ok);
             return true;
         }
+        if (ID == BUTTON_ID_LOG)
+        {
+            std::string name;
+            UnicodeStringBuilder(obj->GetName()).ToString(name);
+            obj->GetData().LogStatistics(name);
+            return true;
+        }
     }
     return false;
 }
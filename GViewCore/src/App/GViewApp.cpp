@@ -54,6 +54,30 @@ bool GView::App::Init()
     }
     return true;
 }
+bool GView::App::InitHeadless()
+{
+    gviewAppInstance = new GView::App::Instance();
+    if (!gviewAppInstance->InitHeadless())
+    {
+        delete gviewAppInstance;
+        gviewAppInstance = nullptr;
+        RETURNERROR(false, "Fail to initialize GView (headless)");
+    }
+    return true;
+}
+bool GView::App::IdentifyFile(const std::filesystem::path& path, std::string_view& typeName)
+{
+    CHECK(gviewAppInstance, false, "GView was not initialized !");
+    auto plg = gviewAppInstance->IdentifyFile(path);
+    CHECK(plg, false, "");
+    typeName = plg->GetName();
+    return true;
+}
+bool GView::App::AnalyzeFile(const std::filesystem::path& path, GView::Utils::JSONWriter& output)
+{
+    CHECK(gviewAppInstance, false, "GView was not initialized !");
+    return gviewAppInstance->AnalyzeFile(path, output);
+}
 void GView::App::Run()
 {
     if (gviewAppInstance)
@@ -98,6 +122,9 @@ bool GView::App::ResetConfiguration()
 
     // generic GView settings
     ini["GView"]["CacheSize"]        = DEFAULT_CACHE_SIZE;
+    ini["GView"]["CachePageSize"]    = GView::Utils::DEFAULT_CACHE_PAGE_SIZE;
+    ini["GView"]["MemoryMapping"]    = true;
+    ini["GView"]["ReadAhead"]        = true;
 
     const std::array<std::reference_wrapper<KeyboardControl>, 6> localKeys = {
         InstanceCommands::INSTANCE_CHANGE_VIEW,     InstanceCommands::INSTANCE_SWITCH_TO_VIEW, InstanceCommands::INSTANCE_COMMAND_GOTO,
@@ -147,6 +174,25 @@ void GView::App::OpenBuffer(
     if (gviewAppInstance)
         gviewAppInstance->AddBufferWindow(buf, name, path, method, typeName, parent);
 }
+void GView::App::OpenBuffer(
+      Buffer&& buf, const ConstString& name, const ConstString& path, OpenMethod method, std::string_view typeName, Reference<Window> parent)
+{
+    if (gviewAppInstance)
+        gviewAppInstance->AddBufferWindow(std::move(buf), name, path, method, typeName, parent);
+}
+void GView::App::OpenRange(
+      Reference<GView::Object> object,
+      uint64 offset,
+      uint64 size,
+      const ConstString& name,
+      const ConstString& path,
+      OpenMethod method,
+      std::string_view typeName,
+      Reference<Window> parent)
+{
+    if (gviewAppInstance)
+        gviewAppInstance->AddRangeWindow(object, offset, size, name, path, method, typeName, parent);
+}
 
 Reference<GView::Object> GView::App::GetObject(uint32 index)
 {
@@ -68,6 +68,9 @@ bool AddMenuCommands(Menu* mnu, const GViewMenuCommand* list, size_t count)
 Instance::Instance()
 {
     this->defaultCacheSize         = DEFAULT_CACHE_SIZE;
+    this->cachePageSize            = GView::Utils::DEFAULT_CACHE_PAGE_SIZE;
+    this->useMemoryMapping         = true;
+    this->useReadAhead             = true;
     this->mnuWindow                = nullptr;
     this->mnuHelp                  = nullptr;
     this->mnuFile                  = nullptr;
@@ -77,9 +80,13 @@ bool Instance::LoadSettings()
 {
     auto ini = AppCUI::Application::GetAppSettings();
     CHECK(ini, false, "");
-    CHECK(ini->GetSectionsCount() > 0, false, "");
+    return LoadSettings(*ini);
+}
+bool Instance::LoadSettings(AppCUI::Utils::IniObject& ini)
+{
+    CHECK(ini.GetSectionsCount() > 0, false, "");
     // check plugins
-    for (auto section : *ini) {
+    for (auto section : ini) {
         auto sectionName = section.GetName();
         if (String::StartsWith(sectionName, "type.", true)) {
             GView::Type::Plugin p;
@@ -101,10 +108,14 @@ bool Instance::LoadSettings()
 
     // sort all plugins based on their priority
     std::sort(this->typePlugins.begin(), this->typePlugins.end());
+    this->typePluginsIndex.Build(this->typePlugins);
 
     // read instance settings
-    auto sect                                  = ini->GetSection("GView");
+    auto sect                                  = ini.GetSection("GView");
     this->defaultCacheSize                     = std::max<>(sect.GetValue("CacheSize").ToUInt32(DEFAULT_CACHE_SIZE), MIN_CACHE_SIZE);
+    this->cachePageSize                        = sect.GetValue("CachePageSize").ToUInt32(GView::Utils::DEFAULT_CACHE_PAGE_SIZE);
+    this->useMemoryMapping                     = sect.GetValue("MemoryMapping").ToBool(true);
+    this->useReadAhead                         = sect.GetValue("ReadAhead").ToBool(true);
 
     const std::array<std::reference_wrapper<KeyboardControl>, 6> localKeys = {
         InstanceCommands::INSTANCE_CHANGE_VIEW,     InstanceCommands::INSTANCE_SWITCH_TO_VIEW, InstanceCommands::INSTANCE_COMMAND_GOTO,
@@ -181,6 +192,88 @@ bool Instance::Init()
     dsk->Handlers()->OnStart = this;
     return true;
 }
+bool Instance::InitHeadless()
+{
+    // no AppCUI initialization (no terminal) => read the settings directly
+    const auto settingsPath = AppCUI::Application::GetAppSettingsFile();
+    if (!std::filesystem::exists(settingsPath)) {
+        CHECK(GView::App::ResetConfiguration(), false, "");
+    }
+    AppCUI::Utils::IniObject ini;
+    CHECK(ini.CreateFromFile(settingsPath), false, "Fail to load settings from: %s", settingsPath.u8string().c_str());
+    this->typePlugins.reserve(128);
+    CHECK(LoadSettings(ini), false, "Invalid configuration file: %s", settingsPath.u8string().c_str());
+    this->defaultPlugin.Init();
+
+    // plugins are loaded upfront so that IdentifyFile does not change them (it can be called from multiple threads)
+    for (auto& pType : this->typePlugins) {
+        if (!pType.Load())
+            errList.AddWarning("Fail to load type plugin (%s)", pType.GetName().data());
+    }
+    return true;
+}
+Reference<GView::Type::Plugin> Instance::IdentifyFile(const std::filesystem::path& path)
+{
+    // only the first bytes are needed
+    GView::Utils::DataCache cache;
+    CHECK(cache.Init(path, MIN_CACHE_SIZE, this->useMemoryMapping, this->cachePageSize), nullptr, "Fail to open: %s", path.u8string().c_str());
+    auto buf = cache.Get(0, 0x8800, false);
+    GView::Type::Matcher::TextParser tp(buf);
+
+    auto u16Extension = path.extension().u16string();
+    std::string extension{ u16Extension.begin(), u16Extension.end() };
+    return IdentifyTypePlugin_FirstMatch(extension, buf, tp, GView::Type::Plugin::ExtensionToHash(std::u16string_view(u16Extension)));
+}
+bool Instance::AnalyzeFile(const std::filesystem::path& path, GView::Utils::JSONWriter& output)
+{
+    output.Clear();
+    output.BeginObject();
+    output.AddString("path", std::u16string_view(path.u16string()));
+
+    GView::Utils::DataCache cache;
+    if (!cache.Init(path, this->defaultCacheSize, this->useMemoryMapping, this->cachePageSize)) {
+        output.AddString("error", "unable to read the file");
+        output.EndObject();
+        RETURNERROR(false, "Fail to open: %s", path.u8string().c_str());
+    }
+    output.AddNumber("size", cache.GetSize());
+
+    auto buf = cache.Get(0, 0x8800, false);
+    GView::Type::Matcher::TextParser tp(buf);
+    auto u16Extension = path.extension().u16string();
+    std::string extension{ u16Extension.begin(), u16Extension.end() };
+    auto plg = IdentifyTypePlugin_FirstMatch(extension, buf, tp, GView::Type::Plugin::ExtensionToHash(std::u16string_view(u16Extension)));
+    if (plg->GetName().empty()) {
+        output.AddNull("type");
+        output.EndObject();
+        return true;
+    }
+    output.AddString("type", plg->GetName());
+    if (!plg->HasAnalyze()) {
+        // the type plugin can only be used with a window
+        output.EndObject();
+        return true;
+    }
+
+    // every file gets its own content type and object => files can be analyzed in parallel
+    std::unique_ptr<TypeInterface> contentType(plg->CreateInstance());
+    if (!contentType) {
+        output.AddString("error", "unable to create a content type object");
+        output.EndObject();
+        RETURNERROR(false, "'CreateInstance' returned a null pointer to a content type object !");
+    }
+    GView::Object obj(GView::Object::Type::File, std::move(cache), contentType.get(), path.filename().u16string(), path.u16string(), 0);
+
+    const auto level = output.GetLevel();
+    output.BeginObject("analysis");
+    const auto result = plg->Analyze(&obj, &output);
+    // whatever the plugin left open is closed so that the output is always a valid JSON
+    output.Close(level);
+    if (!result)
+        output.AddString("error", "the type plugin could not parse the file");
+    output.EndObject();
+    return result;
+}
 Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin_WithSelectedType(
       const AppCUI::Utils::ConstString& name,
       const AppCUI::Utils::ConstString& path,
@@ -246,7 +339,8 @@ Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin_FirstMatch(
 {
     // check for extension first
     if (extensionHash != 0) {
-        for (auto& pType : this->typePlugins) {
+        for (auto idx : this->typePluginsIndex.GetExtensionCandidates(extensionHash)) {
+            auto& pType = this->typePlugins[idx];
             if (pType.MatchExtension(extensionHash)) {
                 if (pType.IsOfType(buf, textParser, extension))
                     return &pType;
@@ -254,8 +348,9 @@ Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin_FirstMatch(
         }
     }
 
-    // check the content
-    for (auto& pType : this->typePlugins) {
+    // check the content (only the plugins that have a pattern for the first byte)
+    for (auto idx : this->typePluginsIndex.GetContentCandidates(buf)) {
+        auto& pType = this->typePlugins[idx];
         if (pType.MatchContent(buf, textParser)) {
             if (pType.IsOfType(buf, textParser))
                 return &pType;
@@ -277,7 +372,8 @@ Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin_BestMatch(
     auto plg   = &this->defaultPlugin;
     auto count = 0;
     if (extensionHash != 0) {
-        for (auto& pType : this->typePlugins) {
+        for (auto idx : this->typePluginsIndex.GetExtensionCandidates(extensionHash)) {
+            auto& pType = this->typePlugins[idx];
             if (pType.MatchExtension(extensionHash)) {
                 if (pType.IsOfType(buf, textParser)) {
                     count++;
@@ -290,7 +386,8 @@ Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin_BestMatch(
     }
 
     // check the content
-    for (auto& pType : this->typePlugins) {
+    for (auto idx : this->typePluginsIndex.GetContentCandidates(buf)) {
+        auto& pType = this->typePlugins[idx];
         if (pType.MatchContent(buf, textParser)) {
             if (pType.IsOfType(buf, textParser)) {
                 count++;
@@ -313,12 +410,9 @@ Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin(
       std::string_view typeName,
       std::u16string& newName)
 {
-    auto buf    = cache.Get(0, 0x8800, false);
-    auto bomLen = 0U;
-    auto enc    = GView::Utils::CharacterEncoding::AnalyzeBufferForEncoding(buf, true, bomLen);
-    auto text =
-          enc != GView::Utils::CharacterEncoding::Encoding::Binary ? GView::Utils::CharacterEncoding::ConvertToUnicode16(buf) : GView::Utils::UnicodeString();
-    auto tp = GView::Type::Matcher::TextParser(text.text, text.size);
+    auto buf = cache.Get(0, 0x8800, false);
+    // the UTF-16 text is only built if a text matcher is reached
+    GView::Type::Matcher::TextParser tp(buf);
     auto sz = cache.GetSize();
 
     LocalUnicodeStringBuilder<256> temp;
@@ -346,7 +440,7 @@ Reference<GView::Type::Plugin> Instance::IdentifyTypePlugin(
 }
 bool Instance::Add(
       GView::Object::Type objType,
-      std::unique_ptr<AppCUI::OS::DataObject> data,
+      GView::Utils::DataCache&& cache,
       const AppCUI::Utils::ConstString& name,
       const AppCUI::Utils::ConstString& path,
       uint32 PID,
@@ -369,9 +463,6 @@ bool Instance::Add(
         }
     }
 
-    GView::Utils::DataCache cache;
-    CHECK(cache.Init(std::move(data), this->defaultCacheSize), false, "Fail to instantiate cache object");
-
     // extract extension
     LocalUnicodeStringBuilder<256> temp;
     CHECK(temp.Set(path), false, "Fail to get path object");
@@ -441,12 +532,13 @@ bool Instance::AddFileWindow(const std::filesystem::path& path, OpenMethod metho
         if (std::filesystem::is_directory(path)) {
             return AddFolder(path);
         } else {
-            auto f = std::make_unique<AppCUI::OS::File>();
-            if (f->OpenRead(path) == false) {
+            GView::Utils::DataCache cache;
+            if (cache.Init(path, this->defaultCacheSize, this->useMemoryMapping, this->cachePageSize) == false) {
                 errList.AddError("Fail to open file: %s", path.u8string().c_str());
                 RETURNERROR(false, "Fail to open file: %s", path.u8string().c_str());
             }
-            return Add(Object::Type::File, std::move(f), path.filename().u16string(), path.u16string(), 0, method, typeName, parent);
+            cache.SetReadAhead(this->useReadAhead);
+            return Add(Object::Type::File, std::move(cache), path.filename().u16string(), path.u16string(), 0, method, typeName, parent);
         }
     } catch (std::filesystem::filesystem_error /* e */) {
         errList.AddError("Fail to open file: %s", path.u8string().c_str());
@@ -456,12 +548,43 @@ bool Instance::AddFileWindow(const std::filesystem::path& path, OpenMethod metho
 bool Instance::AddBufferWindow(
       BufferView buf, const ConstString& name, const ConstString& path, OpenMethod method, string_view typeName, Reference<Window> parent)
 {
-    auto f = std::make_unique<AppCUI::OS::MemoryFile>();
-    if (f->Create(buf.GetData(), buf.GetLength()) == false) {
-        errList.AddError("Fail to open memory buffer of size: %llu", buf.GetLength());
-        RETURNERROR(false, "Fail to open memory buffer of size: %llu", buf.GetLength());
+    // the caller owns "buf" => a single copy is made and adopted by the object
+    Buffer copy;
+    if (buf.GetLength() > 0) {
+        copy.Resize(buf.GetLength());
+        memcpy(copy.GetData(), buf.GetData(), buf.GetLength());
+    }
+    return AddBufferWindow(std::move(copy), name, path, method, typeName, parent);
+}
+bool Instance::AddBufferWindow(
+      Buffer&& buf, const ConstString& name, const ConstString& path, OpenMethod method, string_view typeName, Reference<Window> parent)
+{
+    const auto size = (uint64) buf.GetLength();
+    GView::Utils::DataCache cache;
+    if (cache.Init(std::move(buf), this->defaultCacheSize) == false) {
+        errList.AddError("Fail to open memory buffer of size: %llu", size);
+        RETURNERROR(false, "Fail to open memory buffer of size: %llu", size);
+    }
+    return Add(Object::Type::MemoryBuffer, std::move(cache), name, path, 0, method, typeName, parent);
+}
+bool Instance::AddRangeWindow(
+      Reference<GView::Object> object,
+      uint64 offset,
+      uint64 size,
+      const ConstString& name,
+      const ConstString& path,
+      OpenMethod method,
+      string_view typeName,
+      Reference<Window> parent)
+{
+    CHECK(object.IsValid(), false, "Expecting a valid object !");
+    GView::Utils::DataCache cache;
+    if (cache.Init(object->GetData(), offset, size, this->defaultCacheSize, this->cachePageSize) == false) {
+        errList.AddError("Fail to open range [0x%llX, 0x%llX)", offset, offset + size);
+        RETURNERROR(false, "Fail to open range [0x%llX, 0x%llX)", offset, offset + size);
     }
-    return Add(Object::Type::MemoryBuffer, std::move(f), name, path, 0, method, typeName, parent);
+    cache.SetReadAhead(this->useReadAhead);
+    return Add(Object::Type::MemoryBuffer, std::move(cache), name, path, 0, method, typeName, parent);
 }
 void Instance::OpenFile()
 {
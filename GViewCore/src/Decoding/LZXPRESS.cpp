@@ -48,7 +48,11 @@ struct Stream
 
         if (size >= sizeof(uint16) || offset <= (size - sizeof(uint16)))
         {
-            *((uint16*) &bits) = *((uint16*) (stream + offset));
+            // the low 16 bits are zero after the shift (writing them through an uint16* breaks strict aliasing => optimized builds
+            // kept using the old value of "bits")
+            uint16 value;
+            memcpy(&value, stream + offset, sizeof(value));
+            bits |= value;
             offset += sizeof(uint16);
         }
     }
@@ -4,18 +4,77 @@
 #include <array>
 
 constexpr uint32 MAX_NUMBER_OF_BYTES = 256;
+constexpr uint32 SUB_HISTOGRAMS      = 4;
+constexpr uint64 MAX_CHUNK_SIZE      = 0xFFFFFFFF; // the uint32 counters of a sub-histogram can not overflow
+constexpr uint64 REPEATED_BYTE       = 0x0101010101010101ULL;
+constexpr uint32 COUNT_LOG2_SIZE     = 0x1001; // block sizes used by the entropy visualizer (at most 4K counts for a value)
 
 namespace GView::Entropy
 {
-void SetFrequencies(const BufferView& buffer, std::array<char, MAX_NUMBER_OF_BYTES>& frequency)
+using SubHistograms = std::array<std::array<uint32, MAX_NUMBER_OF_BYTES>, SUB_HISTOGRAMS>;
+
+/*
+    Consecutive bytes are counted in different (interleaved) sub-histograms: a value repeated in the input no longer waits
+    for the store of the previous increment of the same counter. The input is read 16 bytes at a time and spans of a single
+    repeated byte (zero padding, filled sections) are detected with two 64 bit comparisons and counted with one addition.
+*/
+static void CountChunk(const uint8* input, size_t length, SubHistograms& counts)
 {
-    // Count frequency of each byte in the buffer
-    for (uint32 i = 0; i < buffer.GetLength(); i++) {
-        const auto c = buffer[i];
-        frequency[c]++;
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint64 low, high;
+        memcpy(&low, input + i, sizeof(low));
+        memcpy(&high, input + i + 8, sizeof(high));
+        if ((low == high) && (low == (low & 0xFF) * REPEATED_BYTE)) {
+            counts[0][low & 0xFF] += 16;
+            continue;
+        }
+        for (uint32 shift = 0; shift < 64; shift += 32) {
+            counts[0][(low >> shift) & 0xFF]++;
+            counts[1][(low >> (shift + 8)) & 0xFF]++;
+            counts[2][(low >> (shift + 16)) & 0xFF]++;
+            counts[3][(low >> (shift + 24)) & 0xFF]++;
+            counts[0][(high >> shift) & 0xFF]++;
+            counts[1][(high >> (shift + 8)) & 0xFF]++;
+            counts[2][(high >> (shift + 16)) & 0xFF]++;
+            counts[3][(high >> (shift + 24)) & 0xFF]++;
+        }
+    }
+    for (; i < length; i++) {
+        counts[i % SUB_HISTOGRAMS][input[i]]++;
     }
 }
 
+void UpdateHistogram(const BufferView& buffer, Histogram& histogram)
+{
+    SubHistograms counts;
+    for (size_t offset = 0; offset < buffer.GetLength(); offset += MAX_CHUNK_SIZE) {
+        for (auto& sub : counts) {
+            sub.fill(0);
+        }
+        CountChunk(buffer.GetData() + offset, std::min<size_t>(MAX_CHUNK_SIZE, buffer.GetLength() - offset), counts);
+        for (uint32 value = 0; value < MAX_NUMBER_OF_BYTES; value++) {
+            histogram[value] += static_cast<uint64>(counts[0][value]) + counts[1][value] + counts[2][value] + counts[3][value];
+        }
+    }
+}
+
+// c * log2(c) - with n bytes, -p * log2(p) for a value with c occurrences is (c * log2(n) - c * log2(c)) / n
+static inline double CountLog2(uint64 count)
+{
+    static const auto table = []() {
+        std::array<double, COUNT_LOG2_SIZE> values{};
+        for (uint32 c = 1; c < COUNT_LOG2_SIZE; c++) {
+            values[c] = c * log2(static_cast<double>(c));
+        }
+        return values;
+    }();
+    if (count < COUNT_LOG2_SIZE) {
+        return table[count];
+    }
+    return count * log2(static_cast<double>(count));
+}
+
 /*
     In physics, the word entropy has important physical implications as the amount of "disorder" of a system.
     In mathematics, a more abstract definition is used.
@@ -26,26 +85,28 @@ void SetFrequencies(const BufferView& buffer, std::array<char, MAX_NUMBER_OF_BYT
 
     The joint entropy of variables X_1, ..., X_n is then defined by
     H(X_1, ..., X_n) congruent - sum_(x_1) ... sum_(x_n) P(x_1, ..., x_n) log_2[P(x_1, ..., x_n)].
+
+    With integer counts c_x (n = sum_x c_x): H(X) = log_2(n) - (1/n) sum_x c_x log_2(c_x).
 */
-double ShannonEntropy_private(const BufferView& buffer, std::array<char, MAX_NUMBER_OF_BYTES>& frequency)
+double ShannonEntropy(const Histogram& histogram)
 {
-    double entropy = 0.0;
-    for (auto f : frequency) {
-        if (f == 0) {
-            continue;
-        }
-        double probability = static_cast<double>(f) / buffer.GetLength();
-        entropy -= probability * log2(probability);
+    uint64 total = 0;
+    double sum   = 0.0;
+    for (auto count : histogram) {
+        total += count;
+        sum += CountLog2(count);
     }
-
-    return entropy; // max log2(n) = 8 (the entire sum)
+    if (total == 0) {
+        return 0.0;
+    }
+    return std::max(log2(static_cast<double>(total)) - sum / total, 0.0); // max log2(n) = 8 (the entire sum)
 }
 
 double ShannonEntropy(const BufferView& buffer)
 {
-    std::array<char, MAX_NUMBER_OF_BYTES> frequency{};
-    SetFrequencies(buffer, frequency);
-    return ShannonEntropy_private(buffer, frequency);
+    Histogram histogram{};
+    UpdateHistogram(buffer, histogram);
+    return ShannonEntropy(histogram);
 }
 
 /*
@@ -56,20 +117,32 @@ double ShannonEntropy(const BufferView& buffer)
     H_α(p_1, p_2, ..., p_n)<=H_α'(p_1, p_2, ..., p_n)
     for α<=α'.
 */
-double RenyiEntropy(const BufferView& buffer, double alpha)
+double RenyiEntropy(const Histogram& histogram, double alpha)
 {
-    std::array<char, MAX_NUMBER_OF_BYTES> frequency{};
-    SetFrequencies(buffer, frequency);
-
     if (alpha == 1.0) {
-        return ShannonEntropy_private(buffer, frequency);
+        return ShannonEntropy(histogram);
+    }
+
+    uint64 total = 0;
+    for (auto count : histogram) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0.0;
     }
 
     double sum = 0.0;
-    for (auto f : frequency) {
-        if (f > 0) {
-            const double probability = static_cast<double>(f) / buffer.GetLength();
-            sum += pow(probability, alpha);
+    if (alpha == 2.0) {
+        // collision entropy - no pow() calls
+        for (auto count : histogram) {
+            sum += static_cast<double>(count) * static_cast<double>(count);
+        }
+        sum /= static_cast<double>(total) * static_cast<double>(total);
+    } else {
+        for (auto count : histogram) {
+            if (count > 0) {
+                sum += pow(static_cast<double>(count) / total, alpha);
+            }
         }
     }
 
@@ -77,4 +150,11 @@ double RenyiEntropy(const BufferView& buffer, double alpha)
     // return std::max(((1.0 / (1.0 - alpha)) * log(sum)) / log(2), 0.0);
     return ((1.0 / (1.0 - alpha)) * log(sum)) / log(2);
 }
+
+double RenyiEntropy(const BufferView& buffer, double alpha)
+{
+    Histogram histogram{};
+    UpdateHistogram(buffer, histogram);
+    return RenyiEntropy(histogram, alpha);
+}
 } // namespace GView::Entropy
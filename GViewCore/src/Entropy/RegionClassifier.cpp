@@ -0,0 +1,276 @@
+#include "Internal.hpp"
+
+#include <math.h>
+#include <array>
+
+namespace GView::Entropy
+{
+constexpr uint32 BIGRAMS_COUNT     = 0x10000;
+constexpr uint64 MIN_ZERO_RUN      = 4;
+constexpr uint64 MIN_CHI_SQUARE    = 256 * 5; // at least 5 expected occurrences for each value => chi-square is meaningful
+constexpr double RANDOM_CHI_SQUARE = 310.5;   // 99th percentile for 255 degrees of freedom
+constexpr double PADDING_ZERO_RUNS = 0.75;    // ratio of bytes in zero runs
+constexpr double PADDING_ENTROPY   = 1.0;     // one or two values (0xFF, 0xCC fills)
+constexpr double TEXT_PRINTABLE    = 0.95;    // ratio of printable bytes
+constexpr double HIGH_ENTROPY      = 7.2;     // compressed or encrypted
+constexpr double RANDOM_BIGRAMS    = 0.9;     // bigram entropy / the one expected for independent bytes
+constexpr double CODE_MIN_ENTROPY  = 4.5;
+constexpr double CODE_MIN_SCORE    = 0.6;     // x64 code has 0.75 - 0.9, random data 0.4, text 0.05
+
+constexpr uint16 BIGRAM_CARRY_AT = 0xFFFF;
+constexpr uint16 BIGRAM_CARRY    = 0x8000; // moved to "carries" => a counter is never 0 again after its first occurrence
+
+struct RegionClassifierData
+{
+    // [previous byte << 8 | byte] - 16 bit counters (the table stays in the L2 cache) with the carries in a table allocated by the
+    // first bigram with 64K occurrences
+    std::vector<uint16> bigrams;
+    std::vector<uint32> carries;
+    // bigrams with at least one occurrence (each one is added once) => reset and summed without going through all of them
+    std::vector<uint16> touched;
+    uint32 touchedCount{ 0 };
+    uint64 size{ 0 };
+    uint64 zeroRuns{ 0 }; // bytes of the finished zero runs (at least MIN_ZERO_RUN long)
+    uint64 zeroRun{ 0 };  // length of the current zero run
+    uint8 first{ 0 };
+    uint8 previous{ 0 };
+
+    RegionClassifierData() : bigrams(BIGRAMS_COUNT, 0), touched(BIGRAMS_COUNT, 0)
+    {
+    }
+    inline uint64 GetBigramCount(uint16 bigram) const
+    {
+        return bigrams[bigram] + (carries.empty() ? 0ULL : static_cast<uint64>(carries[bigram]) * BIGRAM_CARRY);
+    }
+};
+
+/*
+    Frequency (per mille) of the most common bytes of x64 code (measured on the code sections of large binaries): REX prefixes,
+    mov/lea/call/jmp/jcc opcodes, ModR/M and SIB bytes (0x24 - [rsp + disp]), small displacements and immediates, 0x0F escapes
+    and multi-byte nops. The other values are about 1 per mille each => the profile is a distribution over all the 256 values.
+*/
+static const std::array<double, 256>& GetCodeProfile()
+{
+    static const auto profile = []() {
+        std::array<double, 256> values;
+        values.fill(1.0);
+        const std::pair<uint8, double> common[] = {
+            { 0x00, 124 }, { 0x48, 78 }, { 0xFF, 58 }, { 0x89, 44 }, { 0x0F, 37 }, { 0x8B, 30 }, { 0x24, 22 }, { 0xE8, 19 }, { 0x83, 17 },
+            { 0x4C, 16 },  { 0x01, 16 }, { 0x41, 15 }, { 0x44, 14 }, { 0x8D, 13 }, { 0x85, 12 }, { 0x84, 12 }, { 0x08, 11 }, { 0x1F, 11 },
+            { 0x49, 10 },  { 0xC0, 10 }, { 0x10, 9 },  { 0xE9, 9 },  { 0x74, 8 },  { 0x66, 7 },  { 0xFA, 7 },  { 0x45, 7 },  { 0xC7, 7 },
+            { 0x31, 7 },   { 0x40, 6 },  { 0x18, 6 },  { 0xF3, 6 },  { 0xC3, 6 },  { 0x80, 6 },  { 0xF8, 5 },  { 0x04, 5 },  { 0x05, 5 },
+            { 0x50, 5 },   { 0x03, 5 },  { 0x39, 5 },  { 0x1E, 5 },  { 0xFE, 5 },  { 0x02, 5 },  { 0x75, 4 },  { 0x20, 4 },  { 0xF6, 4 },
+            { 0x5D, 4 },   { 0x43, 4 },  { 0xDF, 4 },  { 0xEB, 4 },  { 0x55, 4 },  { 0xC6, 4 },  { 0xC1, 4 },  { 0xC4, 4 },  { 0xCC, 4 },
+        };
+        for (const auto& [value, frequency] : common) {
+            values[value] = frequency;
+        }
+        double total = 0.0;
+        for (auto value : values) {
+            total += value;
+        }
+        for (auto& value : values) {
+            value /= total;
+        }
+        return values;
+    }();
+    return profile;
+}
+
+// 2^(-KL(p || code profile)) - 1 for bytes distributed as in code, lower for any other distribution.
+// KL(p || q) = sum(p * log2(p / q)) = cross entropy - entropy => no logarithm for each value
+static double ComputeCodeScore(const Histogram& histogram, uint64 size, double shannon)
+{
+    static const auto log2Profile = []() {
+        const auto& profile = GetCodeProfile();
+        std::array<double, 256> values;
+        for (uint32 value = 0; value < 256; value++) {
+            values[value] = log2(profile[value]);
+        }
+        return values;
+    }();
+    double crossEntropy = 0.0;
+    for (uint32 value = 0; value < 256; value++) {
+        crossEntropy -= histogram[value] * log2Profile[value];
+    }
+    return exp2(-std::max(crossEntropy / size - shannon, 0.0));
+}
+
+RegionClassifier::RegionClassifier()
+{
+    data = new RegionClassifierData();
+}
+RegionClassifier::~RegionClassifier()
+{
+    delete reinterpret_cast<RegionClassifierData*>(data);
+}
+
+void RegionClassifier::Reset()
+{
+    auto d = reinterpret_cast<RegionClassifierData*>(data);
+    for (uint32 i = 0; i < d->touchedCount; i++) {
+        d->bigrams[d->touched[i]] = 0;
+    }
+    if (!d->carries.empty()) {
+        for (uint32 i = 0; i < d->touchedCount; i++) {
+            d->carries[d->touched[i]] = 0;
+        }
+    }
+    d->touchedCount = 0;
+    d->size         = 0;
+    d->zeroRuns     = 0;
+    d->zeroRun      = 0;
+}
+
+void RegionClassifier::Update(const BufferView& buffer)
+{
+    auto d = reinterpret_cast<RegionClassifierData*>(data);
+    CHECKRET(buffer.GetLength() > 0, "");
+
+    const auto* input = buffer.GetData();
+    const auto length = buffer.GetLength();
+    size_t i          = 0;
+    if (d->size == 0) {
+        // the first byte has no previous one (it is counted only in the byte histogram)
+        d->first    = input[0];
+        d->previous = input[0];
+        d->zeroRun  = input[0] == 0 ? 1 : 0;
+        i           = 1;
+    }
+
+    auto previous     = d->previous;
+    auto zeroRun      = d->zeroRun;
+    auto zeroRuns     = d->zeroRuns;
+    auto touchedCount = d->touchedCount;
+    auto bigrams      = d->bigrams.data();
+    auto touched      = d->touched.data();
+    for (; i < length; i++) {
+        const auto value  = input[i];
+        const auto bigram = static_cast<uint16>((previous << 8) | value);
+        auto& count       = bigrams[bigram];
+        if (count == 0) {
+            touched[touchedCount++] = bigram;
+        }
+        if (++count == BIGRAM_CARRY_AT) {
+            if (d->carries.empty()) {
+                d->carries.resize(BIGRAMS_COUNT, 0);
+            }
+            d->carries[bigram]++;
+            count -= BIGRAM_CARRY;
+        }
+        // no branch (zeros and other values alternate in code and structures)
+        zeroRuns += ((value != 0) && (zeroRun >= MIN_ZERO_RUN)) ? zeroRun : 0;
+        zeroRun  = (value == 0) ? zeroRun + 1 : 0;
+        previous = value;
+    }
+    d->previous     = previous;
+    d->zeroRun      = zeroRun;
+    d->zeroRuns     = zeroRuns;
+    d->touchedCount = touchedCount;
+    d->size += length;
+}
+
+RegionStatistics RegionClassifier::GetStatistics() const
+{
+    auto d = reinterpret_cast<RegionClassifierData*>(data);
+    RegionStatistics statistics{};
+    statistics.size = d->size;
+    if (d->size == 0) {
+        return statistics;
+    }
+
+    // the byte histogram is the sum of the bigrams ending with each value (and the first byte) => no other count in Update
+    Histogram histogram{};
+    histogram[d->first] = 1;
+    double bigramsSum   = 0.0;
+    for (uint32 i = 0; i < d->touchedCount; i++) {
+        const auto bigram = d->touched[i];
+        const auto count  = d->GetBigramCount(bigram);
+        histogram[bigram & 0xFF] += count;
+        if (count > 1) {
+            bigramsSum += count * log2(static_cast<double>(count));
+        }
+    }
+    const auto pairs = d->size - 1;
+    if (pairs > 0) {
+        statistics.bigramEntropy = std::max(log2(static_cast<double>(pairs)) - bigramsSum / pairs, 0.0);
+    }
+
+    const auto size     = static_cast<double>(d->size);
+    const auto expected = size / 256.0;
+    uint64 printable    = histogram['\t'] + histogram['\n'] + histogram['\r'];
+    for (uint32 value = 0; value < 256; value++) {
+        const auto delta = histogram[value] - expected;
+        statistics.chiSquare += delta * delta / expected;
+        if ((value >= 0x20) && (value < 0x7F)) {
+            printable += histogram[value];
+        }
+    }
+
+    const auto zeroRuns       = d->zeroRuns + (d->zeroRun >= MIN_ZERO_RUN ? d->zeroRun : 0);
+    statistics.shannon        = ShannonEntropy(histogram);
+    statistics.printableRatio = printable / size;
+    statistics.zeroRunRatio   = zeroRuns / size;
+    statistics.codeScore      = ComputeCodeScore(histogram, d->size, statistics.shannon);
+    return statistics;
+}
+
+RegionType RegionClassifier::GetRegionType() const
+{
+    return Classify(GetStatistics());
+}
+
+RegionType RegionClassifier::Classify(const RegionStatistics& statistics)
+{
+    if ((statistics.size == 0) || (statistics.zeroRunRatio >= PADDING_ZERO_RUNS) || (statistics.shannon < PADDING_ENTROPY)) {
+        return RegionType::Padding;
+    }
+    if (statistics.printableRatio >= TEXT_PRINTABLE) {
+        return RegionType::Text;
+    }
+
+    // independent bytes => the entropy of a pair is twice the one of a byte (at most log2 of the number of pairs)
+    const auto pairs         = static_cast<double>(std::max<uint64>(statistics.size - 1, 1));
+    const auto randomBigrams = std::min(2.0 * statistics.shannon, log2(pairs));
+    const auto independent   = statistics.bigramEntropy >= RANDOM_BIGRAMS * randomBigrams;
+    if ((statistics.shannon >= HIGH_ENTROPY) && independent) {
+        // a uniform distribution can be told from a compressed stream only if there are enough bytes (the output of strong
+        // compressors - LZMA, zstd - is also uniform and it is reported as encrypted)
+        if ((statistics.size >= MIN_CHI_SQUARE) && (statistics.chiSquare <= RANDOM_CHI_SQUARE)) {
+            return RegionType::Encrypted;
+        }
+        return RegionType::Compressed;
+    }
+    if ((statistics.shannon >= CODE_MIN_ENTROPY) && (statistics.codeScore >= CODE_MIN_SCORE)) {
+        return RegionType::Code;
+    }
+    return RegionType::Data;
+}
+
+RegionType RegionClassifier::Classify(const BufferView& buffer, RegionStatistics& statistics)
+{
+    RegionClassifier classifier;
+    classifier.Update(buffer);
+    statistics = classifier.GetStatistics();
+    return Classify(statistics);
+}
+
+std::string_view RegionClassifier::GetRegionTypeName(RegionType type)
+{
+    switch (type) {
+    case RegionType::Padding:
+        return "Padding";
+    case RegionType::Text:
+        return "Text";
+    case RegionType::Code:
+        return "Code";
+    case RegionType::Compressed:
+        return "Compressed";
+    case RegionType::Encrypted:
+        return "Encrypted";
+    case RegionType::Data:
+        return "Data";
+    }
+    return "";
+}
+} // namespace GView::Entropy
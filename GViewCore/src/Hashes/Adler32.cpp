@@ -1,9 +1,35 @@
 #include "Internal.hpp"
 
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define ADLER32_X64
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define ADLER32_SSSE3_TARGET
+#        define ADLER32_AVX2_TARGET
+#    else
+#        define ADLER32_SSSE3_TARGET __attribute__((target("ssse3")))
+#        define ADLER32_AVX2_TARGET  __attribute__((target("avx2")))
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define ADLER32_ARM64 // NEON is part of the base ARM64 instruction set
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <arm64_neon.h>
+#    else
+#        include <arm_neon.h>
+#    endif
+#endif
+
 namespace GView::Hashes
 {
 constexpr uint32 ADLER32_BASE         = 65521;
 constexpr uint32 ADLER32_MODULO_VALUE = 8;
+// largest number of bytes that can be added to the sums (starting from values < ADLER32_BASE) before a 32 bit overflow
+constexpr uint32 ADLER32_NMAX = 5552;
+// bytes per vector step - s2 gets 32 * (sum of the previous steps) + 32 * byte[0] + 31 * byte[1] + ... + 1 * byte[31]
+constexpr uint32 ADLER32_BLOCK = 32;
 
 bool Adler32::Init()
 {
@@ -15,13 +41,8 @@ bool Adler32::Init()
     return true;
 }
 
-bool Adler32::Update(const unsigned char* input, uint32 length)
+static void UpdateScalar(uint32& s1, uint32& s2, const uint8* input, uint32 length)
 {
-    CHECK(input != nullptr, false, "");
-
-    uint32 s1 = a;
-    uint32 s2 = b;
-
     if (length % ADLER32_MODULO_VALUE != 0)
     {
         do
@@ -66,6 +87,227 @@ bool Adler32::Update(const unsigned char* input, uint32 length)
         }
         s2 %= ADLER32_BASE;
     }
+}
+
+#if defined(ADLER32_X64)
+static bool IsSupported(Adler32Implementation implementation)
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const auto maxLeaf = info[0];
+    __cpuid(info, 1);
+    const auto ssse3   = (info[2] & (1 << 9)) != 0;
+    const auto osxsave = (info[2] & (1 << 27)) != 0;
+    auto avx2          = false;
+    if ((maxLeaf >= 7) && osxsave && ((_xgetbv(0) & 6) == 6))
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#    else
+    __builtin_cpu_init(); // called during the static initialization
+    const auto ssse3 = __builtin_cpu_supports("ssse3") != 0;
+    const auto avx2  = __builtin_cpu_supports("avx2") != 0;
+#    endif
+    switch (implementation)
+    {
+    case Adler32Implementation::Scalar:
+        return true;
+    case Adler32Implementation::SSSE3:
+        return ssse3;
+    case Adler32Implementation::AVX2:
+        return avx2;
+    default:
+        return false;
+    }
+}
+
+ADLER32_SSSE3_TARGET static inline uint32 HorizontalSum(__m128i value)
+{
+    value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+    value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<uint32>(_mm_cvtsi128_si32(value));
+}
+
+ADLER32_SSSE3_TARGET static void UpdateSSSE3(uint32& s1, uint32& s2, const uint8* input, uint32 length)
+{
+    const auto tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    const auto tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const auto zero = _mm_setzero_si128();
+    const auto ones = _mm_set1_epi16(1);
+
+    while (length >= ADLER32_BLOCK)
+    {
+        auto steps = std::min<uint32>(length, ADLER32_NMAX) / ADLER32_BLOCK;
+        length -= steps * ADLER32_BLOCK;
+
+        auto previous = _mm_cvtsi32_si128(static_cast<int32>(s1 * steps)); // s1 is added to s2 for each byte
+        auto sum1     = zero;
+        auto sum2     = zero;
+        do
+        {
+            const auto bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+            const auto bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16));
+            previous          = _mm_add_epi32(previous, sum1);
+            sum1              = _mm_add_epi32(sum1, _mm_sad_epu8(bytes1, zero));
+            sum2              = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tap1), ones));
+            sum1              = _mm_add_epi32(sum1, _mm_sad_epu8(bytes2, zero));
+            sum2              = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tap2), ones));
+            input += ADLER32_BLOCK;
+        } while (--steps);
+        sum2 = _mm_add_epi32(sum2, _mm_slli_epi32(previous, 5));
+
+        s1 = (s1 + HorizontalSum(sum1)) % ADLER32_BASE;
+        s2 = (s2 + HorizontalSum(sum2)) % ADLER32_BASE;
+    }
+    UpdateScalar(s1, s2, input, length);
+}
+
+ADLER32_AVX2_TARGET static void UpdateAVX2(uint32& s1, uint32& s2, const uint8* input, uint32 length)
+{
+    const auto tap = _mm256_setr_epi8(
+          32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const auto zero = _mm256_setzero_si256();
+    const auto ones = _mm256_set1_epi16(1);
+
+    while (length >= ADLER32_BLOCK)
+    {
+        auto steps = std::min<uint32>(length, ADLER32_NMAX) / ADLER32_BLOCK;
+        length -= steps * ADLER32_BLOCK;
+
+        auto previous = _mm256_setr_epi32(static_cast<int32>(s1 * steps), 0, 0, 0, 0, 0, 0, 0); // s1 is added to s2 for each byte
+        auto sum1     = zero;
+        auto sum2     = zero;
+        do
+        {
+            const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+            previous         = _mm256_add_epi32(previous, sum1);
+            sum1             = _mm256_add_epi32(sum1, _mm256_sad_epu8(bytes, zero));
+            sum2             = _mm256_add_epi32(sum2, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, tap), ones));
+            input += ADLER32_BLOCK;
+        } while (--steps);
+        sum2 = _mm256_add_epi32(sum2, _mm256_slli_epi32(previous, 5));
+
+        const auto total1 = _mm_add_epi32(_mm256_castsi256_si128(sum1), _mm256_extracti128_si256(sum1, 1));
+        const auto total2 = _mm_add_epi32(_mm256_castsi256_si128(sum2), _mm256_extracti128_si256(sum2, 1));
+        s1                = (s1 + HorizontalSum(total1)) % ADLER32_BASE;
+        s2                = (s2 + HorizontalSum(total2)) % ADLER32_BASE;
+    }
+    UpdateScalar(s1, s2, input, length);
+}
+#elif defined(ADLER32_ARM64)
+static bool IsSupported(Adler32Implementation implementation)
+{
+    return (implementation == Adler32Implementation::Scalar) || (implementation == Adler32Implementation::NEON);
+}
+
+static void UpdateNEON(uint32& s1, uint32& s2, const uint8* input, uint32 length)
+{
+    static const uint16 taps[ADLER32_BLOCK] = { 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                                16, 15, 14, 13, 12, 11, 10, 9,  8,  7,  6,  5,  4,  3,  2,  1 };
+
+    while (length >= ADLER32_BLOCK)
+    {
+        auto steps = std::min<uint32>(length, ADLER32_NMAX) / ADLER32_BLOCK;
+        length -= steps * ADLER32_BLOCK;
+
+        auto previous = vsetq_lane_u32(s1 * steps, vdupq_n_u32(0), 0); // s1 is added to s2 for each byte
+        auto sum1     = vdupq_n_u32(0);
+        // per column sums (at most 255 * ADLER32_NMAX / ADLER32_BLOCK => 16 bits are enough) - multiplied with the taps at the end
+        auto column1 = vdupq_n_u16(0);
+        auto column2 = vdupq_n_u16(0);
+        auto column3 = vdupq_n_u16(0);
+        auto column4 = vdupq_n_u16(0);
+        do
+        {
+            const auto bytes1 = vld1q_u8(input);
+            const auto bytes2 = vld1q_u8(input + 16);
+            previous          = vaddq_u32(previous, sum1);
+            sum1              = vpadalq_u16(sum1, vpadalq_u8(vpaddlq_u8(bytes1), bytes2));
+            column1           = vaddw_u8(column1, vget_low_u8(bytes1));
+            column2           = vaddw_u8(column2, vget_high_u8(bytes1));
+            column3           = vaddw_u8(column3, vget_low_u8(bytes2));
+            column4           = vaddw_u8(column4, vget_high_u8(bytes2));
+            input += ADLER32_BLOCK;
+        } while (--steps);
+
+        auto sum2 = vshlq_n_u32(previous, 5);
+        sum2      = vmlal_u16(sum2, vget_low_u16(column1), vld1_u16(taps));
+        sum2      = vmlal_u16(sum2, vget_high_u16(column1), vld1_u16(taps + 4));
+        sum2      = vmlal_u16(sum2, vget_low_u16(column2), vld1_u16(taps + 8));
+        sum2      = vmlal_u16(sum2, vget_high_u16(column2), vld1_u16(taps + 12));
+        sum2      = vmlal_u16(sum2, vget_low_u16(column3), vld1_u16(taps + 16));
+        sum2      = vmlal_u16(sum2, vget_high_u16(column3), vld1_u16(taps + 20));
+        sum2      = vmlal_u16(sum2, vget_low_u16(column4), vld1_u16(taps + 24));
+        sum2      = vmlal_u16(sum2, vget_high_u16(column4), vld1_u16(taps + 28));
+
+        s1 = (s1 + vaddvq_u32(sum1)) % ADLER32_BASE;
+        s2 = (s2 + vaddvq_u32(sum2)) % ADLER32_BASE;
+    }
+    UpdateScalar(s1, s2, input, length);
+}
+#else
+static bool IsSupported(Adler32Implementation implementation)
+{
+    return implementation == Adler32Implementation::Scalar;
+}
+#endif
+
+static Adler32Implementation GetFastestImplementation()
+{
+    for (auto implementation : { Adler32Implementation::AVX2, Adler32Implementation::SSSE3, Adler32Implementation::NEON })
+    {
+        if (IsSupported(implementation))
+        {
+            return implementation;
+        }
+    }
+    return Adler32Implementation::Scalar;
+}
+static std::atomic<Adler32Implementation> currentImplementation{ GetFastestImplementation() };
+
+bool SetAdler32Implementation(Adler32Implementation implementation)
+{
+    if (implementation == Adler32Implementation::Auto)
+    {
+        implementation = GetFastestImplementation();
+    }
+    CHECK(IsSupported(implementation), false, "Adler32 implementation %u is not supported by this CPU!", static_cast<uint32>(implementation));
+    currentImplementation = implementation;
+    return true;
+}
+
+Adler32Implementation GetAdler32Implementation()
+{
+    return currentImplementation;
+}
+
+bool Adler32::Update(const unsigned char* input, uint32 length)
+{
+    CHECK(input != nullptr, false, "");
+
+    uint32 s1 = a;
+    uint32 s2 = b;
+
+    switch (GetAdler32Implementation())
+    {
+#if defined(ADLER32_X64)
+    case Adler32Implementation::SSSE3:
+        UpdateSSSE3(s1, s2, input, length);
+        break;
+    case Adler32Implementation::AVX2:
+        UpdateAVX2(s1, s2, input, length);
+        break;
+#elif defined(ADLER32_ARM64)
+    case Adler32Implementation::NEON:
+        UpdateNEON(s1, s2, input, length);
+        break;
+#endif
+    default:
+        UpdateScalar(s1, s2, input, length);
+        break;
+    }
 
     CHECK(s1 < ADLER32_BASE, false, "");
     CHECK(s2 < ADLER32_BASE, false, "");
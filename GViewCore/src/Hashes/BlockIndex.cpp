@@ -0,0 +1,436 @@
+#include "Internal.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+namespace GView::Hashes
+{
+using Digest                 = BlockIndex::Digest;
+constexpr uint32 DIGEST_SIZE = BlockIndex::DIGEST_SIZE;
+
+constexpr char INDEX_MAGIC[8]    = { 'G', 'V', 'B', 'L', 'K', 'I', 'D', 'X' };
+constexpr uint32 INDEX_VERSION   = 1;
+constexpr uint8 LEAF_PREFIX      = 0; // different prefixes for blocks and nodes (a block can not have the digest of a node)
+constexpr uint8 NODE_PREFIX      = 1;
+constexpr uint32 MAX_TREE_LEVELS = 65;
+
+struct BlockTree
+{
+    uint32 blockSize{ 0 };
+    uint64 size{ 0 };
+    // levels[0] - the blocks, levels[k][j] - the node over the blocks [j * 2^k, (j + 1) * 2^k); the last node of a level with an
+    // odd size is copied in the next level. A node whose blocks are all in the content is computed in the same way in any tree.
+    std::vector<std::vector<Digest>> levels;
+
+    inline uint64 GetBlocksCount() const
+    {
+        return levels.empty() ? 0 : levels[0].size();
+    }
+    inline uint64 GetBlockLength(uint64 block) const
+    {
+        return std::min<uint64>(blockSize, size - block * blockSize);
+    }
+    void Reset(uint32 _blockSize, uint64 _size)
+    {
+        blockSize = _blockSize;
+        size      = _size;
+        levels.clear();
+        // no reallocation while the nodes are added (the blocks can be read while the tree is built)
+        levels.reserve(MAX_TREE_LEVELS);
+        levels.emplace_back(size / blockSize + (size % blockSize != 0 ? 1 : 0));
+    }
+    void BuildLevels()
+    {
+        while (levels.back().size() > 1)
+        {
+            const auto& children = levels.back();
+            std::vector<Digest> nodes((children.size() + 1) / 2);
+            for (size_t index = 0; index < nodes.size(); index++)
+            {
+                if (index * 2 + 1 == children.size())
+                {
+                    nodes[index] = children[index * 2];
+                    continue;
+                }
+                OpenSSLHash hash(OpenSSLHashKind::Sha256);
+                hash.Update(&NODE_PREFIX, 1);
+                hash.Update(children[index * 2].data(), DIGEST_SIZE * 2);
+                hash.Final();
+                memcpy(nodes[index].data(), hash.Get(), DIGEST_SIZE);
+            }
+            levels.push_back(std::move(nodes));
+        }
+    }
+    // whole blocks of [offset, offset+size) - the last block of the content is whole even if it is shorter
+    void GetWholeBlocks(uint64 offset, uint64 length, uint64& first, uint64& count) const
+    {
+        const auto end  = std::min<uint64>(offset + length, size);
+        const auto last = end == size ? GetBlocksCount() : end / blockSize;
+        first           = (offset + blockSize - 1) / blockSize;
+        count           = last > first ? last - first : 0;
+    }
+    // first block (relative to "first") that differs from the one of "other" or "count" if all of them are identical
+    uint64 FindDifference(uint64 first, const BlockTree& other, uint64 otherFirst, uint64 count) const
+    {
+        for (uint64 index = 0; index < count;)
+        {
+            // the same position in both trees => the largest node that starts with the block is compared first
+            size_t level = 0;
+            if (first == otherFirst)
+            {
+                const auto block = first + index;
+                while ((level + 1 < levels.size()) && (level + 1 < other.levels.size()) && ((block & ((2ULL << level) - 1)) == 0) &&
+                       (index + (2ULL << level) <= count))
+                {
+                    level++;
+                }
+            }
+            while (levels[level][(first + index) >> level] != other.levels[level][(otherFirst + index) >> level])
+            {
+                if (level == 0)
+                {
+                    return index;
+                }
+                level--;
+            }
+            index += 1ULL << level;
+        }
+        return count;
+    }
+    void GetDifferentBlocks(const BlockTree& other, std::vector<uint64>& blocks) const
+    {
+        blocks.clear();
+        const auto blocksCount = GetBlocksCount();
+        auto common            = std::min<uint64>(blocksCount, other.GetBlocksCount());
+        // the last common block can be the (shorter) last block of one of the contents
+        if ((common > 0) && (GetBlockLength(common - 1) != other.GetBlockLength(common - 1)))
+        {
+            common--;
+        }
+        for (uint64 block = 0; block < common; block++)
+        {
+            block += FindDifference(block, other, block, common - block);
+            if (block < common)
+            {
+                blocks.push_back(block);
+            }
+        }
+        for (uint64 block = common; block < blocksCount; block++)
+        {
+            blocks.push_back(block);
+        }
+    }
+    bool Save(const std::filesystem::path& path) const
+    {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        CHECK(file.is_open(), false, "Fail to create: %s", path.u8string().c_str());
+        file.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        file.write(reinterpret_cast<const char*>(&INDEX_VERSION), sizeof(INDEX_VERSION));
+        file.write(reinterpret_cast<const char*>(&blockSize), sizeof(blockSize));
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(reinterpret_cast<const char*>(levels[0].data()), static_cast<std::streamsize>(levels[0].size() * DIGEST_SIZE));
+        file.close();
+        CHECK(file.good(), false, "Fail to write: %s", path.u8string().c_str());
+        return true;
+    }
+    // the file is next to the content (it can be corrupted or crafted) => it is used only if its size matches the header
+    bool Load(const std::filesystem::path& path, uint32 expectedBlockSize)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            return false; // not saved yet
+        }
+        const auto fileSize = static_cast<uint64>(file.tellg());
+        file.seekg(0);
+        char magic[sizeof(INDEX_MAGIC)];
+        uint32 version = 0, savedBlockSize = 0;
+        uint64 savedSize = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        file.read(reinterpret_cast<char*>(&savedBlockSize), sizeof(savedBlockSize));
+        file.read(reinterpret_cast<char*>(&savedSize), sizeof(savedSize));
+        CHECK(file.good() && (memcmp(magic, INDEX_MAGIC, sizeof(magic)) == 0) && (version == INDEX_VERSION),
+              false,
+              "Invalid block index: %s",
+              path.u8string().c_str());
+        if (savedBlockSize != expectedBlockSize)
+        {
+            return false; // computed for other blocks (not comparable)
+        }
+        const auto digestsSize = fileSize - static_cast<uint64>(file.tellg());
+        const auto blocksCount = savedSize / savedBlockSize + (savedSize % savedBlockSize != 0 ? 1 : 0);
+        CHECK((digestsSize % DIGEST_SIZE == 0) && (blocksCount == digestsSize / DIGEST_SIZE),
+              false,
+              "Invalid block index: %s (%llu blocks, %llu bytes of digests)",
+              path.u8string().c_str(),
+              blocksCount,
+              digestsSize);
+        Reset(savedBlockSize, savedSize);
+        file.read(reinterpret_cast<char*>(levels[0].data()), static_cast<std::streamsize>(levels[0].size() * DIGEST_SIZE));
+        CHECK(file.good(), false, "Invalid block index: %s", path.u8string().c_str());
+        BuildLevels();
+        return true;
+    }
+};
+
+struct BlockIndexData
+{
+    BlockTree tree;
+    BlockTree previous; // loaded from the index file (if any)
+    bool hasPrevious{ false };
+    std::thread worker;
+    std::atomic<bool> stop{ false };
+    std::atomic<bool> ready{ false };
+    std::atomic<uint64> processed{ 0 }; // blocks from levels[0] that can be read while the index is built
+};
+
+static void HashBlocks(BlockIndexData* d, Utils::DataCache& reader, const std::filesystem::path& indexFile)
+{
+    if (!indexFile.empty())
+    {
+        d->hasPrevious = d->previous.Load(indexFile, d->tree.blockSize);
+    }
+    auto& blocks = d->tree.levels[0];
+    for (uint64 block = 0; block < blocks.size(); block++)
+    {
+        if (d->stop.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        const auto length = static_cast<uint32>(d->tree.GetBlockLength(block));
+        const auto buffer = reader.Get(block * d->tree.blockSize, length, true);
+        if (!buffer.IsValid())
+        {
+            LOG_ERROR("Fail to read %u bytes from offset %llu", length, block * d->tree.blockSize);
+            return;
+        }
+        OpenSSLHash hash(OpenSSLHashKind::Sha256);
+        hash.Update(&LEAF_PREFIX, 1);
+        hash.Update(buffer.GetData(), length);
+        hash.Final();
+        memcpy(blocks[block].data(), hash.Get(), DIGEST_SIZE);
+        d->processed.store(block + 1, std::memory_order_release);
+    }
+    d->tree.BuildLevels();
+    // the patches are not on the disk => the index would not describe the file
+    if (!indexFile.empty() && !reader.HasPatches())
+    {
+        d->tree.Save(indexFile);
+    }
+    d->ready.store(true, std::memory_order_release);
+}
+
+static void BuildBlockIndex(BlockIndexData* d, Utils::DataCache reader, std::filesystem::path indexFile)
+{
+    // an exception would terminate the process (it is not caught on a worker thread)
+    try
+    {
+        HashBlocks(d, reader, indexFile);
+    }
+    catch (const std::bad_alloc&)
+    {
+        d->hasPrevious = false;
+        LOG_ERROR("Not enough memory for the block index of %llu bytes", reader.GetSize());
+    }
+}
+
+BlockIndex::BlockIndex()
+{
+    data = new BlockIndexData();
+}
+BlockIndex::~BlockIndex()
+{
+    Cancel();
+    delete reinterpret_cast<BlockIndexData*>(data);
+}
+
+bool BlockIndex::Build(const Utils::DataCache& cache, uint32 blockSize, const std::filesystem::path& indexFile)
+{
+    CHECK(blockSize > 0, false, "Invalid block size");
+    Cancel();
+    auto d = reinterpret_cast<BlockIndexData*>(data);
+    d->stop.store(false);
+    d->ready.store(false);
+    d->processed.store(0);
+    d->hasPrevious = false;
+    try
+    {
+        d->tree.Reset(blockSize, cache.GetSize());
+    }
+    catch (const std::bad_alloc&)
+    {
+        RETURNERROR(false, "Not enough memory for the block index of %llu bytes", cache.GetSize());
+    }
+
+    auto reader = cache.CreateReader(std::max<uint32>(cache.GetCacheSize(), blockSize));
+    CHECK(reader.GetCacheSize() >= blockSize, false, "Fail to create a reader for blocks of %u bytes", blockSize);
+    d->worker = std::thread(BuildBlockIndex, d, std::move(reader), indexFile);
+    return true;
+}
+void BlockIndex::Cancel()
+{
+    auto d = reinterpret_cast<BlockIndexData*>(data);
+    if (d->worker.joinable())
+    {
+        d->stop.store(true);
+        d->worker.join();
+    }
+}
+bool BlockIndex::Wait()
+{
+    auto d = reinterpret_cast<BlockIndexData*>(data);
+    if (d->worker.joinable())
+    {
+        d->worker.join();
+    }
+    return IsReady();
+}
+bool BlockIndex::IsReady() const
+{
+    return reinterpret_cast<const BlockIndexData*>(data)->ready.load(std::memory_order_acquire);
+}
+uint64 BlockIndex::GetProcessedBlocks() const
+{
+    return reinterpret_cast<const BlockIndexData*>(data)->processed.load(std::memory_order_acquire);
+}
+
+uint32 BlockIndex::GetBlockSize() const
+{
+    return reinterpret_cast<const BlockIndexData*>(data)->tree.blockSize;
+}
+uint64 BlockIndex::GetBlocksCount() const
+{
+    return reinterpret_cast<const BlockIndexData*>(data)->tree.GetBlocksCount();
+}
+uint64 BlockIndex::GetSize() const
+{
+    return reinterpret_cast<const BlockIndexData*>(data)->tree.size;
+}
+bool BlockIndex::GetBlockDigest(uint64 block, Digest& digest) const
+{
+    auto d = reinterpret_cast<const BlockIndexData*>(data);
+    CHECK(block < GetProcessedBlocks(), false, "Block %llu is not processed yet", block);
+    digest = d->tree.levels[0][block];
+    return true;
+}
+bool BlockIndex::GetRootDigest(Digest& digest) const
+{
+    auto d = reinterpret_cast<const BlockIndexData*>(data);
+    CHECK(IsReady(), false, "The index is not complete");
+    CHECK(d->tree.GetBlocksCount() > 0, false, "Empty content");
+    digest = d->tree.levels.back()[0];
+    return true;
+}
+
+std::optional<bool> BlockIndex::AreRangesEqual(uint64 offset, const BlockIndex& other, uint64 otherOffset, uint64 size) const
+{
+    if (!IsReady() || !other.IsReady())
+    {
+        return std::nullopt;
+    }
+    const auto& a = reinterpret_cast<const BlockIndexData*>(data)->tree;
+    const auto& b = reinterpret_cast<const BlockIndexData*>(other.data)->tree;
+    if (size == 0)
+    {
+        return true;
+    }
+    if ((a.blockSize != b.blockSize) || (offset + size > a.size) || (otherOffset + size > b.size) ||
+        (offset % a.blockSize != otherOffset % b.blockSize))
+    {
+        return std::nullopt;
+    }
+
+    uint64 firstA, countA, firstB, countB;
+    a.GetWholeBlocks(offset, size, firstA, countA);
+    b.GetWholeBlocks(otherOffset, size, firstB, countB);
+    auto count = std::min<uint64>(countA, countB);
+    if ((count > 0) && (a.GetBlockLength(firstA + count - 1) != b.GetBlockLength(firstB + count - 1)))
+    {
+        count--;
+    }
+    if (a.FindDifference(firstA, b, firstB, count) < count)
+    {
+        return false;
+    }
+    // the whole blocks cover both ranges
+    if ((count > 0) && (firstA * a.blockSize == offset) && (firstB * b.blockSize == otherOffset) &&
+        (std::min<uint64>((firstA + count) * a.blockSize, a.size) == offset + size) &&
+        (std::min<uint64>((firstB + count) * b.blockSize, b.size) == otherOffset + size))
+    {
+        return true;
+    }
+    return std::nullopt;
+}
+uint64 BlockIndex::GetIdenticalSize(uint64 offset, const BlockIndex& other, uint64 otherOffset, uint64 size) const
+{
+    if (!IsReady() || !other.IsReady())
+    {
+        return 0;
+    }
+    const auto& a = reinterpret_cast<const BlockIndexData*>(data)->tree;
+    const auto& b = reinterpret_cast<const BlockIndexData*>(other.data)->tree;
+    if ((a.blockSize != b.blockSize) || (offset % a.blockSize != 0) || (otherOffset % b.blockSize != 0) || (offset >= a.size) ||
+        (otherOffset >= b.size))
+    {
+        return 0;
+    }
+    size = std::min<uint64>({ size, a.size - offset, b.size - otherOffset });
+
+    uint64 firstA, countA, firstB, countB;
+    a.GetWholeBlocks(offset, size, firstA, countA);
+    b.GetWholeBlocks(otherOffset, size, firstB, countB);
+    auto count = std::min<uint64>(countA, countB);
+    if ((count > 0) && (a.GetBlockLength(firstA + count - 1) != b.GetBlockLength(firstB + count - 1)))
+    {
+        count--;
+    }
+    const auto identical = a.FindDifference(firstA, b, firstB, count);
+    return std::min<uint64>((firstA + identical) * a.blockSize, a.size) - offset;
+}
+bool BlockIndex::GetDifferentBlocks(const BlockIndex& other, std::vector<uint64>& blocks) const
+{
+    CHECK(IsReady() && other.IsReady(), false, "The indexes are not complete");
+    const auto& a = reinterpret_cast<const BlockIndexData*>(data)->tree;
+    const auto& b = reinterpret_cast<const BlockIndexData*>(other.data)->tree;
+    CHECK(a.blockSize == b.blockSize, false, "Different block sizes: %u and %u", a.blockSize, b.blockSize);
+    a.GetDifferentBlocks(b, blocks);
+    return true;
+}
+bool BlockIndex::GetChangedBlocks(std::vector<uint64>& blocks) const
+{
+    auto d = reinterpret_cast<const BlockIndexData*>(data);
+    CHECK(IsReady(), false, "The index is not complete");
+    CHECK(d->hasPrevious, false, "");
+    CHECK(d->tree.blockSize == d->previous.blockSize, false, "The previous index uses blocks of %u bytes", d->previous.blockSize);
+    d->tree.GetDifferentBlocks(d->previous, blocks);
+    return true;
+}
+} // namespace GView::Hashes
+
+GView::Hashes::BlockIndex& GView::Object::GetBlockIndex(bool useIndexFile)
+{
+    // the digests of a patched content are outdated => the index is computed again (the previous one is stopped)
+    if ((blockIndex) && (blockIndexPatchesVersion != cache.GetPatchesVersion()))
+    {
+        blockIndex.reset();
+    }
+    if (!blockIndex)
+    {
+        // the index file describes the file on disk => it is not used for a patched content
+        std::filesystem::path indexFile;
+        if ((useIndexFile) && (objectType == Type::File) && (!filePath.ToStringView().empty()) && (!cache.HasPatches()))
+        {
+            indexFile = filePath.ToStringView();
+            indexFile += ".blocks.cache";
+        }
+        blockIndex               = std::make_unique<Hashes::BlockIndex>();
+        blockIndexPatchesVersion = cache.GetPatchesVersion();
+        if (!blockIndex->Build(cache, Hashes::BlockIndex::DEFAULT_BLOCK_SIZE, indexFile))
+        {
+            LOG_ERROR("Fail to start computing the block index of: %s", std::filesystem::path(filePath.ToStringView()).u8string().c_str());
+        }
+    }
+    return *blockIndex;
+}
@@ -0,0 +1,326 @@
+#include "CRC.hpp"
+
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define CRC_CLMUL_X64
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define CRC_CLMUL_TARGET
+#    else
+#        define CRC_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define CRC_CLMUL_ARM64
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <arm64_neon.h>
+#        define CRC_CLMUL_TARGET
+#    else
+#        include <arm_neon.h>
+#        if defined(__clang__)
+#            define CRC_CLMUL_TARGET __attribute__((target("aes")))
+#        else
+#            define CRC_CLMUL_TARGET __attribute__((target("+crypto")))
+#        endif
+#    endif
+#    if defined(BUILD_FOR_WINDOWS)
+#        include <Windows.h>
+#        undef GetObject
+#    elif defined(BUILD_FOR_UNIX)
+#        include <sys/auxv.h>
+#        include <asm/hwcap.h>
+#    endif
+#endif
+
+namespace GView::Hashes
+{
+namespace CRC
+{
+    constexpr uint16 CRC16_POLYNOMIAL = 0x1021;
+    constexpr uint32 CRC32_POLYNOMIAL = 0x04C11DB7; // not reflected (the reflected one is 0xEDB88320)
+    constexpr uint64 CRC64_POLYNOMIAL = 0x42F0E1EBA9EA3693;
+
+    // x^n mod P
+    static uint16 PowerModulo16(uint32 n)
+    {
+        uint16 r = 1;
+        while (n--)
+        {
+            r = static_cast<uint16>((r << 1) ^ ((r & 0x8000) ? CRC16_POLYNOMIAL : 0));
+        }
+        return r;
+    }
+    static uint32 PowerModulo32(uint32 n)
+    {
+        uint32 r = 1;
+        while (n--)
+        {
+            r = (r << 1) ^ ((r & 0x80000000) ? CRC32_POLYNOMIAL : 0);
+        }
+        return r;
+    }
+    static uint64 PowerModulo64(uint32 n)
+    {
+        uint64 r = 1;
+        while (n--)
+        {
+            r = (r << 1) ^ ((r >> 63) ? CRC64_POLYNOMIAL : 0);
+        }
+        return r;
+    }
+    // bit k <=> x^(63-k) (the bit order of a reflected CRC)
+    static uint64 Reflect(uint32 value)
+    {
+        uint64 r = 0;
+        for (auto i = 0U; i < 32; i++)
+        {
+            if (value & (1U << i))
+            {
+                r |= 1ULL << (63 - i);
+            }
+        }
+        return r;
+    }
+
+    // Folding: the 128 bits of the accumulator (H * x^64 + L) are moved "distance" bits forward => H * (x^(distance+64) mod P) +
+    // L * (x^distance mod P), congruent modulo P and of at most 127 bits. The constants are the { first, second } 64 bit
+    // lanes of the accumulator multipliers (the first lane holds L for CRC16 / CRC64 - the blocks are byte-swapped - and H for CRC32).
+    // The product of two reflected 64-bit values is one bit short (bit k <=> x^(126-k)) => x^(n-1) is used for reflected CRCs.
+    struct FoldConstants
+    {
+        uint64 crc16[2][2]; // 128 bits, 512 bits
+        uint64 crc32[2][2];
+        uint64 crc64[2][2];
+
+        FoldConstants()
+        {
+            const uint32 distances[] = { 128, 512 };
+            for (auto i = 0U; i < 2; i++)
+            {
+                crc16[i][0] = PowerModulo16(distances[i]);
+                crc16[i][1] = PowerModulo16(distances[i] + 64);
+                crc32[i][0] = Reflect(PowerModulo32(distances[i] + 63));
+                crc32[i][1] = Reflect(PowerModulo32(distances[i] - 1));
+                crc64[i][0] = PowerModulo64(distances[i]);
+                crc64[i][1] = PowerModulo64(distances[i] + 64);
+            }
+        }
+    };
+    static const FoldConstants constants;
+
+#if defined(CRC_CLMUL_X64)
+    static bool IsCarrylessMultiplySupported()
+    {
+#    if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 1)) && (info[2] & (1 << 9)); // PCLMULQDQ, SSSE3
+#    else
+        __builtin_cpu_init(); // called during the static initialization
+        return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+#    endif
+    }
+
+    CRC_CLMUL_TARGET static inline __m128i Fold(__m128i value, __m128i k)
+    {
+        return _mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11));
+    }
+    CRC_CLMUL_TARGET static inline __m128i Load(const uint8* p, bool swap)
+    {
+        const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        return swap ? _mm_shuffle_epi8(value, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)) : value;
+    }
+
+    CRC_CLMUL_TARGET static size_t Fold(__m128i crc, const uint8* input, size_t length, uint8 folded[16], const uint64 (&k)[2][2], bool swap)
+    {
+        const auto k128 = _mm_set_epi64x(static_cast<int64>(k[0][1]), static_cast<int64>(k[0][0]));
+        const auto k512 = _mm_set_epi64x(static_cast<int64>(k[1][1]), static_cast<int64>(k[1][0]));
+
+        auto x0         = _mm_xor_si128(Load(input, swap), crc);
+        auto x1         = Load(input + 16, swap);
+        auto x2         = Load(input + 32, swap);
+        auto x3         = Load(input + 48, swap);
+        size_t consumed = 64;
+        for (; consumed + 64 <= length; consumed += 64)
+        {
+            x0 = _mm_xor_si128(Fold(x0, k512), Load(input + consumed, swap));
+            x1 = _mm_xor_si128(Fold(x1, k512), Load(input + consumed + 16, swap));
+            x2 = _mm_xor_si128(Fold(x2, k512), Load(input + consumed + 32, swap));
+            x3 = _mm_xor_si128(Fold(x3, k512), Load(input + consumed + 48, swap));
+        }
+        x0 = _mm_xor_si128(Fold(x0, k128), x1);
+        x0 = _mm_xor_si128(Fold(x0, k128), x2);
+        x0 = _mm_xor_si128(Fold(x0, k128), x3);
+        for (; consumed + 16 <= length; consumed += 16)
+        {
+            x0 = _mm_xor_si128(Fold(x0, k128), Load(input + consumed, swap));
+        }
+        if (swap)
+        {
+            x0 = _mm_shuffle_epi8(x0, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), x0);
+        return consumed;
+    }
+
+    size_t Fold16(uint16 crc, const uint8* input, size_t length, uint8 folded[16])
+    {
+        if (length < 64)
+        {
+            return 0;
+        }
+        // the block is byte-swapped => the first 2 bytes are the top of the upper lane
+        return Fold(_mm_set_epi64x(static_cast<int64>(static_cast<uint64>(crc) << 48), 0), input, length, folded, constants.crc16, true);
+    }
+    size_t Fold32(uint32 crc, const uint8* input, size_t length, uint8 folded[16])
+    {
+        if (length < 64)
+        {
+            return 0;
+        }
+        return Fold(_mm_cvtsi32_si128(static_cast<int32>(crc)), input, length, folded, constants.crc32, false);
+    }
+    size_t Fold64(uint64 crc, const uint8* input, size_t length, uint8 folded[16])
+    {
+        if (length < 64)
+        {
+            return 0;
+        }
+        // the block is byte-swapped => the first 8 bytes are the upper lane
+        return Fold(_mm_set_epi64x(static_cast<int64>(crc), 0), input, length, folded, constants.crc64, true);
+    }
+#elif defined(CRC_CLMUL_ARM64)
+    static bool IsCarrylessMultiplySupported()
+    {
+#    if defined(BUILD_FOR_WINDOWS)
+        return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE);
+#    elif defined(BUILD_FOR_OSX)
+        return true; // all Apple ARM64 CPUs have the cryptographic extension
+#    else
+        return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#    endif
+    }
+
+    CRC_CLMUL_TARGET static inline uint64x2_t Fold(uint64x2_t value, const uint64 (&k)[2])
+    {
+        const auto lo = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(value, 0)), static_cast<poly64_t>(k[0]));
+        const auto hi = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(value, 1)), static_cast<poly64_t>(k[1]));
+        return veorq_u64(vreinterpretq_u64_p128(lo), vreinterpretq_u64_p128(hi));
+    }
+    CRC_CLMUL_TARGET static inline uint64x2_t Swap(uint64x2_t value)
+    {
+        const auto bytes = vrev64q_u8(vreinterpretq_u8_u64(value));
+        return vreinterpretq_u64_u8(vextq_u8(bytes, bytes, 8));
+    }
+    CRC_CLMUL_TARGET static inline uint64x2_t Load(const uint8* p, bool swap)
+    {
+        const auto value = vreinterpretq_u64_u8(vld1q_u8(p));
+        return swap ? Swap(value) : value;
+    }
+
+    CRC_CLMUL_TARGET static size_t Fold(uint64x2_t crc, const uint8* input, size_t length, uint8 folded[16], const uint64 (&k)[2][2], bool swap)
+    {
+        auto x0         = veorq_u64(Load(input, swap), crc);
+        auto x1         = Load(input + 16, swap);
+        auto x2         = Load(input + 32, swap);
+        auto x3         = Load(input + 48, swap);
+        size_t consumed = 64;
+        for (; consumed + 64 <= length; consumed += 64)
+        {
+            x0 = veorq_u64(Fold(x0, k[1]), Load(input + consumed, swap));
+            x1 = veorq_u64(Fold(x1, k[1]), Load(input + consumed + 16, swap));
+            x2 = veorq_u64(Fold(x2, k[1]), Load(input + consumed + 32, swap));
+            x3 = veorq_u64(Fold(x3, k[1]), Load(input + consumed + 48, swap));
+        }
+        x0 = veorq_u64(Fold(x0, k[0]), x1);
+        x0 = veorq_u64(Fold(x0, k[0]), x2);
+        x0 = veorq_u64(Fold(x0, k[0]), x3);
+        for (; consumed + 16 <= length; consumed += 16)
+        {
+            x0 = veorq_u64(Fold(x0, k[0]), Load(input + consumed, swap));
+        }
+        vst1q_u8(folded, vreinterpretq_u8_u64(swap ? Swap(x0) : x0));
+        return consumed;
+    }
+
+    size_t Fold16(uint16 crc, const uint8* input, size_t length, uint8 folded[16])
+    {
+        if (length < 64)
+        {
+            return 0;
+        }
+        // the block is byte-swapped => the first 2 bytes are the top of the upper lane
+        const uint64 value[2] = { 0, static_cast<uint64>(crc) << 48 };
+        return Fold(vld1q_u64(value), input, length, folded, constants.crc16, true);
+    }
+    size_t Fold32(uint32 crc, const uint8* input, size_t length, uint8 folded[16])
+    {
+        if (length < 64)
+        {
+            return 0;
+        }
+        const uint64 value[2] = { crc, 0 };
+        return Fold(vld1q_u64(value), input, length, folded, constants.crc32, false);
+    }
+    size_t Fold64(uint64 crc, const uint8* input, size_t length, uint8 folded[16])
+    {
+        if (length < 64)
+        {
+            return 0;
+        }
+        // the block is byte-swapped => the first 8 bytes are the upper lane
+        const uint64 value[2] = { 0, crc };
+        return Fold(vld1q_u64(value), input, length, folded, constants.crc64, true);
+    }
+#else
+    static bool IsCarrylessMultiplySupported()
+    {
+        return false;
+    }
+    size_t Fold16(uint16, const uint8*, size_t, uint8[16])
+    {
+        return 0;
+    }
+    size_t Fold32(uint32, const uint8*, size_t, uint8[16])
+    {
+        return 0;
+    }
+    size_t Fold64(uint64, const uint8*, size_t, uint8[16])
+    {
+        return 0;
+    }
+#endif
+
+    static CRCImplementation GetFastestImplementation()
+    {
+        return IsCarrylessMultiplySupported() ? CRCImplementation::CarrylessMultiply : CRCImplementation::Slicing;
+    }
+    static std::atomic<CRCImplementation> current{ GetFastestImplementation() };
+} // namespace CRC
+
+bool SetCRCImplementation(CRCImplementation implementation)
+{
+    switch (implementation)
+    {
+    case CRCImplementation::Auto:
+        implementation = CRC::GetFastestImplementation();
+        break;
+    case CRCImplementation::Table:
+    case CRCImplementation::Slicing:
+        break;
+    case CRCImplementation::CarrylessMultiply:
+        CHECK(CRC::IsCarrylessMultiplySupported(), false, "Carry-less multiplication is not supported by this CPU!");
+        break;
+    default:
+        RETURNERROR(false, "Unknown CRC implementation: %u", static_cast<uint32>(implementation));
+    }
+    CRC::current = implementation;
+    return true;
+}
+
+CRCImplementation GetCRCImplementation()
+{
+    return CRC::current;
+}
+} // namespace GView::Hashes
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Internal.hpp"
+
+namespace GView::Hashes::CRC
+{
+// Carry-less multiplication folding of the CRC register over the largest prefix of "input" that is a multiple of 16 bytes
+// (at least 64 bytes are needed, otherwise nothing is consumed). The result is "folded" - 16 bytes with the same CRC (starting
+// from a zero register) as the consumed prefix starting from "crc". Returns the number of consumed bytes.
+// Only valid if GetCRCImplementation() is CRCImplementation::CarrylessMultiply.
+size_t Fold16(uint16 crc, const uint8* input, size_t length, uint8 folded[16]); // MSB first, 0x1021
+size_t Fold32(uint32 crc, const uint8* input, size_t length, uint8 folded[16]); // reflected, 0xEDB88320
+size_t Fold64(uint64 crc, const uint8* input, size_t length, uint8 folded[16]); // MSB first, 0x42F0E1EBA9EA3693
+} // namespace GView::Hashes::CRC
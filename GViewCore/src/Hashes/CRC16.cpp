@@ -1,8 +1,8 @@
-#include "Internal.hpp"
+#include "CRC.hpp"
 
 namespace GView::Hashes
 {
-static const uint16_t CRC16FalseTable[] = {
+static constexpr uint16_t CRC16FalseTable[256] = {
     0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
     0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
     0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
@@ -29,15 +29,72 @@ bool CRC16::Init()
     return true;
 }
 
+// slices[k][b] = CRC of byte "b" followed by k zero bytes => 8 independent lookups for 8 bytes
+static constexpr auto CRC16Slices = []()
+{
+    std::array<std::array<uint16, 256>, 8> slices{};
+    for (auto b = 0U; b < 256; b++)
+    {
+        slices[0][b] = CRC16FalseTable[b];
+    }
+    for (auto k = 1U; k < 8; k++)
+    {
+        for (auto b = 0U; b < 256; b++)
+        {
+            slices[k][b] = static_cast<uint16>((slices[k - 1][b] << 8) ^ CRC16FalseTable[slices[k - 1][b] >> 8]);
+        }
+    }
+    return slices;
+}();
+
+static uint16 UpdateTable(uint16 crc, const uint8* input, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        const uint16 j = crc >> 8 ^ input[i];
+        crc            = (uint16) (crc << 8 ^ CRC16FalseTable[j]);
+    }
+    return crc;
+}
+
+static uint16 UpdateSlicing(uint16 crc, const uint8* input, size_t length)
+{
+    const auto& t = CRC16Slices;
+    for (; length >= 8; length -= 8, input += 8)
+    {
+        crc = t[7][input[0] ^ (crc >> 8)] ^ t[6][input[1] ^ (crc & 0xFF)] ^ t[5][input[2]] ^ t[4][input[3]] ^ t[3][input[4]] ^ t[2][input[5]] ^
+              t[1][input[6]] ^ t[0][input[7]];
+    }
+    return UpdateTable(crc, input, length);
+}
+
 bool CRC16::Update(const unsigned char* input, uint32 length)
 {
     CHECK(input != nullptr, false, "");
+    uint16 crc = value;
 
-    for (auto i = 0U; i < length; i++)
+    switch (GetCRCImplementation())
+    {
+    case CRCImplementation::Table:
+        crc = UpdateTable(crc, input, length);
+        break;
+    case CRCImplementation::CarrylessMultiply:
     {
-        const uint16 j = value >> 8 ^ input[i];
-        value          = (uint16) (value << 8 ^ CRC16FalseTable[j]);
+        uint8 folded[16];
+        const auto consumed = CRC::Fold16(crc, input, length, folded);
+        if (consumed > 0)
+        {
+            crc = UpdateSlicing(0, folded, sizeof(folded));
+        }
+        crc = UpdateSlicing(crc, input + consumed, length - consumed);
+        break;
     }
+    default:
+        crc = UpdateSlicing(crc, input, length);
+        break;
+    }
+
+    value = crc;
 
     return true;
 }
@@ -1,8 +1,8 @@
-#include "Internal.hpp"
+#include "CRC.hpp"
 
 namespace GView::Hashes
 {
-static const uint32 CRC32Table[] = {
+static constexpr uint32 CRC32Table[256] = {
     0x00000000L, 0x77073096L, 0xee0e612cL, 0x990951baL, 0x076dc419L, 0x706af48fL, 0xe963a535L, 0x9e6495a3L, 0x0edb8832L, 0x79dcb8a4L,
     0xe0d5e91eL, 0x97d2d988L, 0x09b64c2bL, 0x7eb17cbdL, 0xe7b82d07L, 0x90bf1d91L, 0x1db71064L, 0x6ab020f2L, 0xf3b97148L, 0x84be41deL,
     0x1adad47dL, 0x6ddde4ebL, 0xf4d4b551L, 0x83d385c7L, 0x136c9856L, 0x646ba8c0L, 0xfd62f97aL, 0x8a65c9ecL, 0x14015c4fL, 0x63066cd9L,
@@ -40,14 +40,78 @@ bool CRC32::Init(CRC32Type type)
     return true;
 }
 
+// slices[k][b] = CRC of byte "b" followed by k zero bytes => 16 independent lookups for 16 bytes
+static constexpr auto CRC32Slices = []()
+{
+    std::array<std::array<uint32, 256>, 16> slices{};
+    for (auto b = 0U; b < 256; b++)
+    {
+        slices[0][b] = CRC32Table[b];
+    }
+    for (auto k = 1U; k < 16; k++)
+    {
+        for (auto b = 0U; b < 256; b++)
+        {
+            slices[k][b] = (slices[k - 1][b] >> 8) ^ CRC32Table[slices[k - 1][b] & 0xFF];
+        }
+    }
+    return slices;
+}();
+
+static inline uint32 ReadUInt32(const uint8* p)
+{
+    return static_cast<uint32>(p[0]) | (static_cast<uint32>(p[1]) << 8) | (static_cast<uint32>(p[2]) << 16) | (static_cast<uint32>(p[3]) << 24);
+}
+
+static uint32 UpdateTable(uint32 crc, const uint8* input, size_t length)
+{
+    while (length--)
+    {
+        crc = CRC32Table[(crc & 0xff) ^ *input++] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static uint32 UpdateSlicing(uint32 crc, const uint8* input, size_t length)
+{
+    const auto& t = CRC32Slices;
+    for (; length >= 16; length -= 16, input += 16)
+    {
+        const auto a = ReadUInt32(input) ^ crc;
+        const auto b = ReadUInt32(input + 4);
+        const auto c = ReadUInt32(input + 8);
+        const auto d = ReadUInt32(input + 12);
+        crc = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^ t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24] ^ t[11][b & 0xFF] ^ t[10][(b >> 8) & 0xFF] ^
+              t[9][(b >> 16) & 0xFF] ^ t[8][b >> 24] ^ t[7][c & 0xFF] ^ t[6][(c >> 8) & 0xFF] ^ t[5][(c >> 16) & 0xFF] ^ t[4][c >> 24] ^
+              t[3][d & 0xFF] ^ t[2][(d >> 8) & 0xFF] ^ t[1][(d >> 16) & 0xFF] ^ t[0][d >> 24];
+    }
+    return UpdateTable(crc, input, length);
+}
+
 bool CRC32::Update(const unsigned char* input, uint32 length)
 {
     CHECK(input != nullptr, false, "");
     uint32 crc = value;
 
-    while (length--)
+    switch (GetCRCImplementation())
     {
-        crc = CRC32Table[(crc & 0xff) ^ *input++] ^ (crc >> 8);
+    case CRCImplementation::Table:
+        crc = UpdateTable(crc, input, length);
+        break;
+    case CRCImplementation::CarrylessMultiply:
+    {
+        uint8 folded[16];
+        const auto consumed = CRC::Fold32(crc, input, length, folded);
+        if (consumed > 0)
+        {
+            crc = UpdateSlicing(0, folded, sizeof(folded));
+        }
+        crc = UpdateSlicing(crc, input + consumed, length - consumed);
+        break;
+    }
+    default:
+        crc = UpdateSlicing(crc, input, length);
+        break;
     }
 
     value = crc;
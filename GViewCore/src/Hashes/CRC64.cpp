@@ -1,8 +1,8 @@
-#include "Internal.hpp"
+#include "CRC.hpp"
 
 namespace GView::Hashes
 {
-static const uint64 CRC64Table[256] = {
+static constexpr uint64 CRC64Table[256] = {
     0x0000000000000000, 0x42F0E1EBA9EA3693, 0x85E1C3D753D46D26, 0xC711223CFA3E5BB5, 0x493366450E42ECDF, 0x0BC387AEA7A8DA4C,
     0xCCD2A5925D9681F9, 0x8E224479F47CB76A, 0x9266CC8A1C85D9BE, 0xD0962D61B56FEF2D, 0x17870F5D4F51B498, 0x5577EEB6E6BB820B,
     0xDB55AACF12C73561, 0x99A54B24BB2D03F2, 0x5EB4691841135847, 0x1C4488F3E8F96ED4, 0x663D78FF90E185EF, 0x24CD9914390BB37C,
@@ -65,16 +65,81 @@ bool CRC64::Init(CRC64Type type)
     return true;
 }
 
-bool CRC64::Update(const unsigned char* input, uint32 length)
+// slices[k][b] = CRC of byte "b" followed by k zero bytes => 8 independent lookups for 8 bytes
+static constexpr auto CRC64Slices = []()
 {
-    CHECK(input != nullptr, false, "");
-    uint64 crc = value;
+    std::array<std::array<uint64, 256>, 8> slices{};
+    for (auto b = 0U; b < 256; b++)
+    {
+        slices[0][b] = CRC64Table[b];
+    }
+    for (auto k = 1U; k < 8; k++)
+    {
+        for (auto b = 0U; b < 256; b++)
+        {
+            slices[k][b] = (slices[k - 1][b] << 8) ^ CRC64Table[slices[k - 1][b] >> 56];
+        }
+    }
+    return slices;
+}();
 
+static inline uint64 ReadUInt64BigEndian(const uint8* p)
+{
+    uint64 value = 0;
+    for (auto i = 0U; i < 8; i++)
+    {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+static uint64 UpdateTable(uint64 crc, const uint8* input, size_t length)
+{
     while (length--)
     {
         uint64 i = ((uint64) (crc >> 56) ^ *input++) & 0xFF;
         crc      = CRC64Table[i] ^ (crc << 8);
     }
+    return crc;
+}
+
+static uint64 UpdateSlicing(uint64 crc, const uint8* input, size_t length)
+{
+    const auto& t = CRC64Slices;
+    for (; length >= 8; length -= 8, input += 8)
+    {
+        const auto v = ReadUInt64BigEndian(input) ^ crc;
+        crc          = t[7][v >> 56] ^ t[6][(v >> 48) & 0xFF] ^ t[5][(v >> 40) & 0xFF] ^ t[4][(v >> 32) & 0xFF] ^ t[3][(v >> 24) & 0xFF] ^
+              t[2][(v >> 16) & 0xFF] ^ t[1][(v >> 8) & 0xFF] ^ t[0][v & 0xFF];
+    }
+    return UpdateTable(crc, input, length);
+}
+
+bool CRC64::Update(const unsigned char* input, uint32 length)
+{
+    CHECK(input != nullptr, false, "");
+    uint64 crc = value;
+
+    switch (GetCRCImplementation())
+    {
+    case CRCImplementation::Table:
+        crc = UpdateTable(crc, input, length);
+        break;
+    case CRCImplementation::CarrylessMultiply:
+    {
+        uint8 folded[16];
+        const auto consumed = CRC::Fold64(crc, input, length, folded);
+        if (consumed > 0)
+        {
+            crc = UpdateSlicing(0, folded, sizeof(folded));
+        }
+        crc = UpdateSlicing(crc, input + consumed, length - consumed);
+        break;
+    }
+    default:
+        crc = UpdateSlicing(crc, input, length);
+        break;
+    }
 
     value = crc;
 
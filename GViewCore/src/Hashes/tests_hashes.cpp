@@ -0,0 +1,176 @@
+#include <catch.hpp>
+#include "Internal.hpp"
+
+#include <vector>
+
+using namespace GView::Hashes;
+
+// deterministic content (splitmix64)
+static std::vector<uint8> CreateContent(size_t size, uint64 seed)
+{
+    std::vector<uint8> content(size);
+    for (auto& value : content)
+    {
+        uint64 z = (seed += 0x9E3779B97F4A7C15ULL);
+        z        = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z        = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        value    = static_cast<uint8>(z ^ (z >> 31));
+    }
+    return content;
+}
+
+// bit by bit references (the definitions of the algorithms)
+static uint32 ReferenceAdler32(const uint8* input, size_t length)
+{
+    uint32 a = 1, b = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        a = (a + input[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+static uint16 ReferenceCRC16(const uint8* input, size_t length)
+{
+    uint16 crc = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= static_cast<uint16>(input[i] << 8);
+        for (auto bit = 0U; bit < 8; bit++)
+        {
+            crc = static_cast<uint16>((crc << 1) ^ ((crc & 0x8000) ? 0x1021 : 0));
+        }
+    }
+    return crc;
+}
+static uint32 ReferenceCRC32(const uint8* input, size_t length)
+{
+    uint32 crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= input[i];
+        for (auto bit = 0U; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+        }
+    }
+    return crc;
+}
+static uint64 ReferenceCRC64(uint64 crc, const uint8* input, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= static_cast<uint64>(input[i]) << 56;
+        for (auto bit = 0U; bit < 8; bit++)
+        {
+            crc = (crc << 1) ^ ((crc >> 63) ? 0x42F0E1EBA9EA3693ULL : 0);
+        }
+    }
+    return crc;
+}
+
+// the input is given in two parts (the state must be carried between the calls)
+static uint32 ComputeAdler32(const uint8* input, size_t length, size_t split)
+{
+    Adler32 hash;
+    uint32 result = 0;
+    REQUIRE(hash.Init());
+    REQUIRE(hash.Update(input, static_cast<uint32>(split)));
+    REQUIRE(hash.Update(input + split, static_cast<uint32>(length - split)));
+    REQUIRE(hash.Final(result));
+    return result;
+}
+static uint16 ComputeCRC16(const uint8* input, size_t length, size_t split)
+{
+    CRC16 hash;
+    uint16 result = 0;
+    REQUIRE(hash.Init());
+    REQUIRE(hash.Update(input, static_cast<uint32>(split)));
+    REQUIRE(hash.Update(input + split, static_cast<uint32>(length - split)));
+    REQUIRE(hash.Final(result));
+    return result;
+}
+static uint32 ComputeCRC32(CRC32Type type, const uint8* input, size_t length, size_t split)
+{
+    CRC32 hash;
+    uint32 result = 0;
+    REQUIRE(hash.Init(type));
+    REQUIRE(hash.Update(input, static_cast<uint32>(split)));
+    REQUIRE(hash.Update(input + split, static_cast<uint32>(length - split)));
+    REQUIRE(hash.Final(result));
+    return result;
+}
+static uint64 ComputeCRC64(CRC64Type type, const uint8* input, size_t length, size_t split)
+{
+    CRC64 hash;
+    uint64 result = 0;
+    REQUIRE(hash.Init(type));
+    REQUIRE(hash.Update(input, static_cast<uint32>(split)));
+    REQUIRE(hash.Update(input + split, static_cast<uint32>(length - split)));
+    REQUIRE(hash.Final(result));
+    return result;
+}
+
+constexpr size_t MAX_SHORT_LENGTH = 1100; // more than the vector steps (32 - 64 bytes) and their tails
+constexpr size_t MAX_ALIGNMENT    = 32;
+
+TEST_CASE("Adler32Implementations", "[Hashes]Adler32")
+{
+    const auto content = CreateContent(MAX_SHORT_LENGTH + MAX_ALIGNMENT, 1);
+    const auto ones    = std::vector<uint8>(0x40000, 0xFF); // largest sums => overflow checks
+    const auto random  = CreateContent(0x40000, 2);
+
+    for (auto implementation :
+         { Adler32Implementation::Scalar, Adler32Implementation::SSSE3, Adler32Implementation::AVX2, Adler32Implementation::NEON })
+    {
+        if (!SetAdler32Implementation(implementation))
+            continue;
+        for (size_t offset = 0; offset < MAX_ALIGNMENT; offset++)
+        {
+            for (size_t length = 0; length <= MAX_SHORT_LENGTH; length++)
+            {
+                const auto input = content.data() + offset;
+                REQUIRE(ComputeAdler32(input, length, length) == ReferenceAdler32(input, length));
+            }
+        }
+        for (const auto* buffer : { &ones, &random })
+        {
+            // around the number of bytes between two reductions
+            for (size_t length : { 5551, 5552, 5553, 5552 * 2 + 31, 5552 * 3 + 33, 0x10000 - 1, 0x40000 })
+            {
+                REQUIRE(ComputeAdler32(buffer->data(), length, length) == ReferenceAdler32(buffer->data(), length));
+                REQUIRE(ComputeAdler32(buffer->data(), length, length / 3) == ReferenceAdler32(buffer->data(), length));
+            }
+        }
+    }
+    REQUIRE(SetAdler32Implementation(Adler32Implementation::Auto));
+}
+
+TEST_CASE("CRCImplementations", "[Hashes]CRC")
+{
+    const auto content = CreateContent(MAX_SHORT_LENGTH + MAX_ALIGNMENT, 3);
+    const auto large   = CreateContent(0x40000, 4);
+
+    for (auto implementation : { CRCImplementation::Table, CRCImplementation::Slicing, CRCImplementation::CarrylessMultiply })
+    {
+        if (!SetCRCImplementation(implementation))
+            continue;
+        for (size_t offset = 0; offset < MAX_ALIGNMENT; offset++)
+        {
+            for (size_t length = 0; length <= MAX_SHORT_LENGTH; length++)
+            {
+                const auto input = content.data() + offset;
+                const auto split = (length * offset) / MAX_ALIGNMENT;
+                REQUIRE(ComputeCRC16(input, length, split) == ReferenceCRC16(input, length));
+                REQUIRE(ComputeCRC32(CRC32Type::JAMCRC, input, length, split) == ~ReferenceCRC32(input, length));
+                REQUIRE(ComputeCRC32(CRC32Type::JAMCRC_0, input, length, split) == ReferenceCRC32(input, length));
+                REQUIRE(ComputeCRC64(CRC64Type::WE, input, length, split) == ~ReferenceCRC64(~0ULL, input, length));
+                REQUIRE(ComputeCRC64(CRC64Type::ECMA_182, input, length, split) == ReferenceCRC64(0, input, length));
+            }
+        }
+        REQUIRE(ComputeCRC16(large.data(), large.size(), 12345) == ReferenceCRC16(large.data(), large.size()));
+        REQUIRE(ComputeCRC32(CRC32Type::JAMCRC, large.data(), large.size(), 12345) == ~ReferenceCRC32(large.data(), large.size()));
+        REQUIRE(ComputeCRC64(CRC64Type::WE, large.data(), large.size(), 12345) == ~ReferenceCRC64(~0ULL, large.data(), large.size()));
+    }
+    REQUIRE(SetCRCImplementation(CRCImplementation::Auto));
+}
@@ -74,5 +74,10 @@ bool MagicMatcher::Match(AppCUI::Utils::BufferView buf, TextParser& )
         return memcmp(p, u8, count) == 0;
     }
 }
+bool MagicMatcher::GetFirstByte(uint8& value) const
+{
+    value = u8[0];
+    return count > 0;
+}
 
 } // namespace GView::Type::Matcher
\ No newline at end of file
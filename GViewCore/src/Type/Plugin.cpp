@@ -62,6 +62,7 @@ Plugin::Plugin()
     this->fnValidate       = nullptr;
     this->fnCreateInstance = nullptr;
     this->fnPopulateWindow = nullptr;
+    this->fnAnalyze        = nullptr;
 }
 void Plugin::Init()
 {
@@ -69,6 +70,7 @@ void Plugin::Init()
     this->fnValidate       = DefaultTypePlugin::Validate;
     this->fnCreateInstance = DefaultTypePlugin::CreateInstance;
     this->fnPopulateWindow = DefaultTypePlugin::PopulateWindow;
+    this->fnAnalyze        = nullptr;
     this->Loaded           = true;
     this->Invalid          = false;
 }
@@ -168,6 +170,7 @@ bool Plugin::LoadPlugin()
     this->fnValidate       = lib.GetFunction<decltype(this->fnValidate)>("Validate");
     this->fnCreateInstance = lib.GetFunction<decltype(this->fnCreateInstance)>("CreateInstance");
     this->fnPopulateWindow = lib.GetFunction<decltype(this->fnPopulateWindow)>("PopulateWindow");
+    this->fnAnalyze        = lib.GetFunction<decltype(this->fnAnalyze)>("Analyze"); // optional (used in headless mode)
 
     CHECK(fnValidate, false, "Missing 'Validate' export !");
     CHECK(fnCreateInstance, false, "Missing 'CreateInstance' export !");
@@ -207,17 +210,57 @@ bool Plugin::MatchContent(AppCUI::Utils::BufferView buf, Matcher::TextParser& te
     }
     return false;
 }
-bool Plugin::IsOfType(AppCUI::Utils::BufferView buf, Matcher::TextParser& textParser, const std::string_view& extension)
+void Plugin::GetExtensions(std::vector<uint64>& hashes) const
 {
-    if (this->Invalid)
-        return false;
-    if (!this->Loaded)
+    hashes.clear();
+    if (this->extensions.empty())
+    {
+        if (this->extension != EXTENSION_EMPTY_HASH)
+            hashes.push_back(this->extension);
+    }
+    else
+    {
+        hashes.insert(hashes.end(), this->extensions.begin(), this->extensions.end());
+    }
+}
+bool Plugin::GetContentFirstBytes(std::bitset<256>& bytes) const
+{
+    // returns false if one of the patterns can match regardless of the first byte
+    bytes.reset();
+    uint8 value;
+    if (this->patterns.empty())
+    {
+        if (this->pattern)
+        {
+            if (!this->pattern->GetFirstByte(value))
+                return false;
+            bytes.set(value);
+        }
+    }
+    else
+    {
+        for (auto& p : this->patterns)
+        {
+            if (!p->GetFirstByte(value))
+                return false;
+            bytes.set(value);
+        }
+    }
+    return true;
+}
+bool Plugin::Load()
+{
+    if ((!this->Loaded) && (!this->Invalid))
     {
         this->Invalid = !LoadPlugin();
         this->Loaded  = !this->Invalid;
-        if (this->Invalid)
-            return false; // something went wrong when loading he plugin
     }
+    return this->Loaded;
+}
+bool Plugin::IsOfType(AppCUI::Utils::BufferView buf, Matcher::TextParser& textParser, const std::string_view& extension)
+{
+    if (!Load())
+        return false; // something went wrong when loading he plugin
     // all good -> code is loaded
     return fnValidate(buf, extension);
 }
@@ -228,6 +271,13 @@ bool Plugin::PopulateWindow(Reference<GView::View::WindowInterface> win) const
     CHECK(this->Loaded, false, "Plugin was no loaded. Have you call `Validate` first ?");
     return this->fnPopulateWindow(win);
 }
+bool Plugin::Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output) const
+{
+    CHECK(!this->Invalid, false, "Invalid plugin (not loaded properly or no valid exports)");
+    CHECK(this->Loaded, false, "Plugin was no loaded. Have you call `Validate` first ?");
+    CHECK(this->fnAnalyze, false, "Plugin '%s' does not export an 'Analyze' function !", GetName().data());
+    return this->fnAnalyze(obj, output);
+}
 TypeInterface* Plugin::CreateInstance() const
 {
     CHECK(!this->Invalid, nullptr, "Invalid plugin (not loaded properly or no valid exports)");
@@ -0,0 +1,51 @@
+#include "Internal.hpp"
+
+namespace GView::Type
+{
+void PluginsIndex::Build(const std::vector<Plugin>& plugins)
+{
+    byExtension.clear();
+    anyFirstByte.clear();
+    for (auto& list : byFirstByte)
+        list.clear();
+
+    std::vector<uint64> hashes;
+    std::bitset<256> firstBytes;
+    // plugins are added in their order (priority) so that each list is already sorted
+    for (auto idx = 0U; idx < static_cast<uint32>(plugins.size()); idx++)
+    {
+        plugins[idx].GetExtensions(hashes);
+        for (auto hash : hashes)
+            byExtension[hash].push_back(idx);
+
+        if (plugins[idx].GetContentFirstBytes(firstBytes))
+        {
+            for (auto value = 0U; value < 256; value++)
+            {
+                if (firstBytes[value])
+                    byFirstByte[value].push_back(idx);
+            }
+        }
+        else
+        {
+            // can match any buffer (e.g. text patterns)
+            anyFirstByte.push_back(idx);
+            for (auto& list : byFirstByte)
+                list.push_back(idx);
+        }
+    }
+}
+std::span<const uint32> PluginsIndex::GetExtensionCandidates(uint64 extensionHash) const
+{
+    auto it = byExtension.find(extensionHash);
+    if (it == byExtension.end())
+        return {};
+    return it->second;
+}
+std::span<const uint32> PluginsIndex::GetContentCandidates(AppCUI::Utils::BufferView buf) const
+{
+    if (buf.Empty())
+        return anyFirstByte;
+    return byFirstByte[*buf.GetData()];
+}
+} // namespace GView::Type
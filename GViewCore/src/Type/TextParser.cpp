@@ -2,42 +2,51 @@
 
 namespace GView::Type::Matcher
 {
-TextParser::TextParser(const char16* text, uint32 size)
+using namespace GView::Utils;
+
+TextParser::TextParser(AppCUI::Utils::BufferView _buf) : buf(_buf)
 {
+    this->Raw.text       = nullptr;
+    this->Raw.size       = 0;
+    this->Text.text      = nullptr;
+    this->Text.size      = 0;
+    this->Text.computed  = false;
+    this->Lines.count    = 0;
     this->Lines.computed = false;
+}
+TextParser::~TextParser()
+{
+    this->unicode.Destroy();
+}
+void TextParser::ComputeText()
+{
+    this->Text.computed = true;
 
+    auto bomLen = 0U;
+    if (CharacterEncoding::AnalyzeBufferForEncoding(this->buf, true, bomLen) == CharacterEncoding::Encoding::Binary)
+        return;
+    this->unicode = CharacterEncoding::ConvertToUnicode16(this->buf);
+    auto text     = this->unicode.text;
+    auto size     = this->unicode.size;
     if ((text == nullptr) || (size == 0))
-    {
-        this->Raw.text  = nullptr;
-        this->Text.text = nullptr;
-        this->Raw.size  = 0;
-        this->Text.size = 0;
-    }
-    else
-    {
-        this->Raw.text = text;
-        this->Raw.size = size;
+        return;
 
-        auto p = text;
-        auto e = text + size;
-        while ((p < e) && (((*p) == ' ') || ((*p) == '\t') || ((*p) == '\n') || ((*p) == '\r')))
-            p++;
-        if (p == e)
-        {
-            this->Raw.text  = nullptr;
-            this->Text.text = nullptr;
-            this->Raw.size  = 0;
-            this->Text.size = 0;
-        }
-        else
-        {
-            this->Text.text = p;
-            this->Text.size = static_cast<uint32>(e - p);
-        }
+    auto p = text;
+    auto e = text + size;
+    while ((p < e) && (((*p) == ' ') || ((*p) == '\t') || ((*p) == '\n') || ((*p) == '\r')))
+        p++;
+    if (p < e)
+    {
+        this->Raw.text  = text;
+        this->Raw.size  = size;
+        this->Text.text = p;
+        this->Text.size = static_cast<uint32>(e - p);
     }
 }
 void TextParser::ComputeLineOffsets()
 {
+    if (!this->Text.computed)
+        ComputeText();
     auto p            = this->Text.text;
     auto e            = this->Text.text + this->Text.size;
     auto maxLines     = ARRAY_LEN(this->Lines.offsets);
@@ -58,4 +67,4 @@ void TextParser::ComputeLineOffsets()
     }
     this->Lines.computed = true;
 }
-} // namespace GView::Type::Matcher
\ No newline at end of file
+} // namespace GView::Type::Matcher
@@ -0,0 +1,290 @@
+#include "Internal.hpp"
+
+#include <array>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define BYTE_PATTERN_SSE2 // SSE2 is part of the base x64 instruction set
+#    include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define BYTE_PATTERN_NEON
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <arm64_neon.h>
+#    else
+#        include <arm_neon.h>
+#    endif
+#endif
+
+using namespace GView::Utils;
+
+constexpr uint32 HORSPOOL_MIN_SHIFT      = 4;  // average skip (over all the byte values) for Horspool to be faster than the prefilter
+constexpr uint64 MIN_FALSE_POSITIVES     = 64; // the prefilter is evaluated only after this many candidates that do not match
+constexpr uint64 MIN_BYTES_PER_CANDIDATE = 8;  // fewer bytes scanned for each false positive => the prefilter is dropped
+constexpr uint32 VECTOR_SIZE             = 16;
+
+struct BytePatternData {
+    std::vector<uint8> pattern; // already masked
+    std::vector<uint8> mask;
+    std::vector<uint64> pattern64; // the same values, 8 bytes at a time (the last bytes that do not fill a word are not included)
+    std::vector<uint64> mask64;
+    std::array<uint32, 256> shifts{}; // Horspool: distance from the last occurrence of each value (before the last byte) to the end
+    uint32 length{ 0 };
+    uint32 rare1{ 0 }; // positions compared by the prefilter (the rarest two bytes that are not wildcards)
+    uint32 rare2{ 0 };
+    bool useHorspool{ false };
+
+    inline bool MatchesAt(const uint8* input) const
+    {
+        const auto words = static_cast<uint32>(mask64.size());
+        for (uint32 i = 0; i < words; i++) {
+            uint64 value;
+            memcpy(&value, input + i * 8, sizeof(value));
+            if ((value & mask64[i]) != pattern64[i])
+                return false;
+        }
+        for (uint32 i = words * 8; i < length; i++) {
+            if ((input[i] & mask[i]) != pattern[i])
+                return false;
+        }
+        return true;
+    }
+};
+
+/*
+    Relative frequency of the byte values in the content usually opened in GView (executables, documents, text): zeros and 0xFF
+    fills, ASCII text (spaces, lowercase letters, digits) and the most common x86 opcodes. Only the order matters - the prefilter
+    compares the two bytes of the pattern that are expected to occur least often.
+*/
+static const std::array<uint32, 256>& GetByteFrequencies()
+{
+    static const auto frequencies = []() {
+        std::array<uint32, 256> values;
+        for (uint32 value = 0; value < 256; value++) {
+            if (value >= 0x80)
+                values[value] = 2;
+            else if ((value < 0x20) || (value == 0x7F))
+                values[value] = 3;
+            else if ((value >= 'a') && (value <= 'z'))
+                values[value] = 20;
+            else if ((value >= 'A') && (value <= 'Z'))
+                values[value] = 8;
+            else if ((value >= '0') && (value <= '9'))
+                values[value] = 10;
+            else
+                values[value] = 6;
+        }
+        for (auto value : std::string_view("etaoinsrhl"))
+            values[static_cast<uint8>(value)] = 40;
+        const std::pair<uint8, uint32> common[] = {
+            { 0x00, 100 }, { ' ', 60 },  { 0xFF, 30 }, { '\n', 15 }, { '\r', 12 }, { '\t', 10 }, { 0x01, 8 },
+            { 0x48, 12 },  { 0x8B, 10 }, { 0x89, 10 }, { 0x0F, 8 },  { 0xE8, 6 },  { 0xCC, 6 },  { 0x90, 6 },
+        };
+        for (const auto& [value, frequency] : common)
+            values[value] = frequency;
+        return values;
+    }();
+    return frequencies;
+}
+
+static uint32 GetFrequency(uint8 value, uint8 mask)
+{
+    const auto& frequencies = GetByteFrequencies();
+    if (mask == BytePattern::IGNORE_CASE)
+        return frequencies[value] + frequencies[value | 0x20];
+    return frequencies[value];
+}
+
+static inline bool IsLetter(uint8 value)
+{
+    return ((value | 0x20) >= 'a') && ((value | 0x20) <= 'z');
+}
+
+BytePattern::BytePattern()
+{
+    data = new BytePatternData();
+}
+
+BytePattern::~BytePattern()
+{
+    delete reinterpret_cast<BytePatternData*>(data);
+}
+
+bool BytePattern::Init(BufferView pattern, BufferView mask, bool ignoreCase)
+{
+    auto d = reinterpret_cast<BytePatternData*>(data);
+    CHECK(pattern.GetLength() > 0, false, "");
+    CHECK((mask.GetLength() == 0) || (mask.GetLength() == pattern.GetLength()), false, "");
+
+    const auto length = static_cast<uint32>(pattern.GetLength());
+    d->length         = 0;
+    d->pattern.resize(length);
+    d->mask.resize(length);
+    bool hasFixedByte = false;
+    for (uint32 i = 0; i < length; i++) {
+        auto m = mask.GetLength() > 0 ? mask[i] : EXACT;
+        if (ignoreCase && (m == EXACT) && IsLetter(pattern[i]))
+            m = IGNORE_CASE;
+        d->mask[i]    = m;
+        d->pattern[i] = pattern[i] & m;
+        hasFixedByte |= m != ANY;
+    }
+    CHECK(hasFixedByte, false, "a pattern with wildcards only matches everything");
+
+    d->pattern64.resize(length / 8);
+    d->mask64.resize(length / 8);
+    for (uint32 i = 0; i < length / 8; i++) {
+        memcpy(&d->pattern64[i], d->pattern.data() + i * 8, sizeof(uint64));
+        memcpy(&d->mask64[i], d->mask.data() + i * 8, sizeof(uint64));
+    }
+
+    // a value can be skipped up to the closest position (before the last one) where it would match
+    d->shifts.fill(length);
+    for (uint32 i = 0; i + 1 < length; i++) {
+        for (uint32 value = 0; value < 256; value++) {
+            if ((value & d->mask[i]) == d->pattern[i])
+                d->shifts[value] = length - 1 - i;
+        }
+    }
+    uint64 totalShift = 0;
+    for (auto shift : d->shifts)
+        totalShift += shift;
+    d->useHorspool = totalShift >= HORSPOOL_MIN_SHIFT * 256;
+
+    uint32 rare1 = length, rare2 = length;
+    for (uint32 i = 0; i < length; i++) {
+        if (d->mask[i] == ANY)
+            continue;
+        const auto frequency = GetFrequency(d->pattern[i], d->mask[i]);
+        if ((rare1 == length) || (frequency < GetFrequency(d->pattern[rare1], d->mask[rare1]))) {
+            rare2 = rare1;
+            rare1 = i;
+        } else if ((rare2 == length) || (frequency < GetFrequency(d->pattern[rare2], d->mask[rare2]))) {
+            rare2 = i;
+        }
+    }
+    d->rare1  = rare1;
+    d->rare2  = rare2 == length ? rare1 : rare2;
+    d->length = length;
+    return true;
+}
+
+uint32 BytePattern::GetLength() const
+{
+    return reinterpret_cast<BytePatternData*>(data)->length;
+}
+
+static bool FindHorspool(const BytePatternData& d, const uint8* input, size_t start, size_t last, size_t& position)
+{
+    const auto lastIndex = d.length - 1;
+    const auto lastMask  = d.mask[lastIndex];
+    const auto lastValue = d.pattern[lastIndex];
+    for (auto offset = start; offset <= last;) {
+        const auto value = input[offset + lastIndex];
+        if (((value & lastMask) == lastValue) && d.MatchesAt(input + offset)) {
+            position = offset;
+            return true;
+        }
+        offset += d.shifts[value];
+    }
+    return false;
+}
+
+bool BytePattern::Find(BufferView buffer, size_t start, size_t& position) const
+{
+    auto d = reinterpret_cast<BytePatternData*>(data);
+    CHECK(d->length > 0, false, "Init was not called");
+    if ((buffer.GetLength() < d->length) || (start > buffer.GetLength() - d->length))
+        return false;
+
+    const auto* input   = buffer.GetData();
+    const auto last     = buffer.GetLength() - d->length; // last position where a match can start
+    const auto value1   = d->pattern[d->rare1];
+    const auto mask1    = d->mask[d->rare1];
+    const auto value2   = d->pattern[d->rare2];
+    const auto mask2    = d->mask[d->rare2];
+    auto offset         = start;
+    uint64 falseMatches = 0;
+
+    // candidates have both rare bytes (a vector of positions at a time); if most of them do not match, Horspool is used instead
+    const auto IsPrefilterSlow = [&]() {
+        return d->useHorspool && (falseMatches >= MIN_FALSE_POSITIVES) && (offset - start < falseMatches * MIN_BYTES_PER_CANDIDATE);
+    };
+
+#if defined(BYTE_PATTERN_SSE2)
+    const auto v1 = _mm_set1_epi8(static_cast<char>(value1));
+    const auto m1 = _mm_set1_epi8(static_cast<char>(mask1));
+    const auto v2 = _mm_set1_epi8(static_cast<char>(value2));
+    const auto m2 = _mm_set1_epi8(static_cast<char>(mask2));
+    for (; offset + VECTOR_SIZE - 1 <= last; offset += VECTOR_SIZE) {
+        const auto bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset + d->rare1));
+        const auto bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset + d->rare2));
+        const auto equal1 = _mm_cmpeq_epi8(_mm_and_si128(bytes1, m1), v1);
+        const auto equal2 = _mm_cmpeq_epi8(_mm_and_si128(bytes2, m2), v2);
+        auto candidates   = static_cast<uint32>(_mm_movemask_epi8(_mm_and_si128(equal1, equal2)));
+        while (candidates != 0) {
+            const auto candidate = offset + std::countr_zero(candidates);
+            if (d->MatchesAt(input + candidate)) {
+                position = candidate;
+                return true;
+            }
+            falseMatches++;
+            candidates &= candidates - 1;
+        }
+        if (IsPrefilterSlow())
+            return FindHorspool(*d, input, offset + VECTOR_SIZE, last, position);
+    }
+#elif defined(BYTE_PATTERN_NEON)
+    const auto v1 = vdupq_n_u8(value1);
+    const auto m1 = vdupq_n_u8(mask1);
+    const auto v2 = vdupq_n_u8(value2);
+    const auto m2 = vdupq_n_u8(mask2);
+    for (; offset + VECTOR_SIZE - 1 <= last; offset += VECTOR_SIZE) {
+        const auto equal1 = vceqq_u8(vandq_u8(vld1q_u8(input + offset + d->rare1), m1), v1);
+        const auto equal2 = vceqq_u8(vandq_u8(vld1q_u8(input + offset + d->rare2), m2), v2);
+        // 4 bits for each byte (there is no movemask on NEON) - only the highest one is kept
+        const auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(vandq_u8(equal1, equal2)), 4);
+        auto candidates     = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ULL;
+        while (candidates != 0) {
+            const auto candidate = offset + (std::countr_zero(candidates) >> 2);
+            if (d->MatchesAt(input + candidate)) {
+                position = candidate;
+                return true;
+            }
+            falseMatches++;
+            candidates &= candidates - 1;
+        }
+        if (IsPrefilterSlow())
+            return FindHorspool(*d, input, offset + VECTOR_SIZE, last, position);
+    }
+#else
+    if (mask1 == EXACT) {
+        // memchr is vectorized by the C runtime
+        while (offset <= last) {
+            const auto next = memchr(input + offset + d->rare1, value1, last - offset + 1);
+            if (next == nullptr)
+                return false;
+            offset = static_cast<const uint8*>(next) - input - d->rare1;
+            if (d->MatchesAt(input + offset)) {
+                position = offset;
+                return true;
+            }
+            falseMatches++;
+            offset++;
+            if (IsPrefilterSlow())
+                return FindHorspool(*d, input, offset, last, position);
+        }
+        return false;
+    }
+    if (d->useHorspool)
+        return FindHorspool(*d, input, offset, last, position);
+#endif
+
+    // the positions that do not fill a vector
+    for (; offset <= last; offset++) {
+        if (((input[offset + d->rare1] & mask1) == value1) && d->MatchesAt(input + offset)) {
+            position = offset;
+            return true;
+        }
+    }
+    return false;
+}
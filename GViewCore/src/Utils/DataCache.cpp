@@ -1,145 +1,754 @@
-#include "GView.hpp"
+#include "Internal.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
 
 using namespace GView::Utils;
 
 constexpr uint32 MAX_CACHE_SIZE = 0x20000000U; // 16 M
+constexpr uint32 MIN_PAGE_SIZE  = 0x1000U;     // 4 K
+constexpr uint32 INVALID_SLOT   = 0xFFFFFFFFU;
+constexpr uint64 INVALID_PAGE   = 0xFFFFFFFFFFFFFFFFULL;
+
+struct CachePage {
+    uint64 page;     // index of the file page stored in this slot (INVALID_PAGE for an empty slot)
+    uint64 lastUsed; // LRU tick
+};
+struct DataCachePages {
+    std::vector<CachePage> slots;
+    std::unordered_map<uint64, uint32> lookup; // file page index -> slot
+    uint64 tick;
+    uint32 pageSize;
+};
+
+constexpr uint32 READ_AHEAD_TRIGGER = 2; // consecutive sequential misses before the read-ahead is started
+
+struct GView::Utils::DataCacheSource {
+    std::unique_ptr<AppCUI::OS::DataObject> obj;
+    std::shared_ptr<DataCacheSource> parent; // for ranges: data is read from the parent (starting at "base")
+    uint64 base = 0;
+    std::mutex lock;
+
+    ~DataCacheSource()
+    {
+        if (obj)
+            obj->Close();
+    }
+    bool ReadAt(uint64 offset, uint8* buffer, uint32 size, DataCacheStats& stats)
+    {
+        if (parent)
+            return parent->ReadAt(base + offset, buffer, size, stats);
+        std::lock_guard<std::mutex> guard(lock);
+        CHECK(obj->SetCurrentPos(offset), false, "Fail to move to offset: %llu", offset);
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto ok        = obj->Read(buffer, size);
+        stats.readTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+        stats.refills++;
+        CHECK(ok, false, "Fail to read %u bytes from offset: %llu", size, offset);
+        stats.bytesRead += size;
+        return true;
+    }
+};
+
+struct GView::Utils::DataCachePatches {
+    std::map<uint64, std::vector<uint8>> intervals; // start offset -> modified bytes (sorted, never overlapping or adjacent)
+    std::atomic<uint64> patchedSize{ 0 };
+    std::atomic<uint64> version{ 0 }; // changed by each Patch / ClearPatches
+    mutable std::shared_mutex lock; // readers created with CreateReader() share the overlay
+
+    // first interval that ends after "offset" (expects "lock" to be held by the caller)
+    std::map<uint64, std::vector<uint8>>::const_iterator First(uint64 offset) const
+    {
+        auto it = intervals.upper_bound(offset);
+        if (it != intervals.begin()) {
+            auto prev = std::prev(it);
+            if (prev->first + prev->second.size() > offset)
+                return prev;
+        }
+        return it;
+    }
+    bool Overlaps(uint64 offset, uint64 size) const
+    {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        auto it = First(offset);
+        return (it != intervals.end()) && (it->first < offset + size);
+    }
+    // "dest" holds the original content of [offset, offset+size)
+    void Apply(uint8* dest, uint64 offset, uint64 size) const
+    {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        const auto last = offset + size;
+        for (auto it = First(offset); (it != intervals.end()) && (it->first < last); it++) {
+            const auto from = std::max<uint64>(it->first, offset);
+            const auto to   = std::min<uint64>(it->first + it->second.size(), last);
+            memcpy(dest + (from - offset), it->second.data() + (from - it->first), (size_t) (to - from));
+        }
+    }
+    void Add(uint64 offset, BufferView data)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock);
+        const auto last = offset + data.GetLength();
+
+        // intervals that overlap or touch [offset, last) are merged into a single one
+        auto first = intervals.upper_bound(offset);
+        if ((first != intervals.begin()) && (std::prev(first)->first + std::prev(first)->second.size() >= offset))
+            first--;
+        auto stop = first;
+        auto to   = last;
+        while ((stop != intervals.end()) && (stop->first <= last)) {
+            to = std::max<uint64>(to, stop->first + stop->second.size());
+            stop++;
+        }
+        if ((first == stop) || (first->first > offset)) {
+            std::vector<uint8> bytes((size_t) (to - offset));
+            for (auto it = first; it != stop; it++) {
+                memcpy(bytes.data() + (it->first - offset), it->second.data(), it->second.size());
+                patchedSize -= it->second.size();
+            }
+            memcpy(bytes.data(), data.GetData(), data.GetLength());
+            patchedSize += bytes.size();
+            intervals.erase(first, stop);
+            intervals.emplace_hint(stop, offset, std::move(bytes));
+            return;
+        }
+        // the first interval starts before "offset" ==> extend it (overwriting bytes or appending does not move data)
+        auto& bytes = first->second;
+        patchedSize -= bytes.size();
+        bytes.resize((size_t) (to - first->first));
+        for (auto it = std::next(first); it != stop; it++) {
+            memcpy(bytes.data() + (it->first - first->first), it->second.data(), it->second.size());
+            patchedSize -= it->second.size();
+        }
+        memcpy(bytes.data() + (offset - first->first), data.GetData(), data.GetLength());
+        patchedSize += bytes.size();
+        intervals.erase(std::next(first), stop);
+    }
+    // the modified bytes of [offset, offset+size) are dropped (an interval that crosses a margin keeps the bytes outside the range)
+    void Remove(uint64 offset, uint64 size)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock);
+        const auto last = offset + size;
+        auto it         = intervals.upper_bound(offset);
+        if ((it != intervals.begin()) && (std::prev(it)->first + std::prev(it)->second.size() > offset))
+            it--;
+        while ((it != intervals.end()) && (it->first < last)) {
+            const auto from = it->first;
+            auto bytes      = std::move(it->second);
+            patchedSize -= bytes.size();
+            it = intervals.erase(it);
+            if (from < offset) {
+                patchedSize += offset - from;
+                intervals.emplace(from, std::vector<uint8>(bytes.begin(), bytes.begin() + (size_t) (offset - from)));
+            }
+            if (from + bytes.size() > last) {
+                patchedSize += from + bytes.size() - last;
+                it = intervals.emplace_hint(it, last, std::vector<uint8>(bytes.begin() + (size_t) (last - from), bytes.end()));
+                break;
+            }
+        }
+    }
+    // number of modified bytes in [offset, offset+size)
+    uint64 Count(uint64 offset, uint64 size) const
+    {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        const auto last = offset + size;
+        uint64 count    = 0;
+        for (auto it = First(offset); (it != intervals.end()) && (it->first < last); it++)
+            count += std::min<uint64>(it->first + it->second.size(), last) - std::max<uint64>(it->first, offset);
+        return count;
+    }
+};
+
+enum class ReadAheadState : uint8 {
+    Empty,
+    Pending, // owned by the I/O thread
+    Ready,
+    Failed
+};
+struct ReadAheadBuffer {
+    std::unique_ptr<uint8[]> memory; // [headroom bytes][window bytes]
+    uint8* data;                     // data for offset "start" (the headroom is used to stitch the tail of the previous buffer)
+    uint64 start;
+    uint32 size;
+    ReadAheadState state;
+};
+struct DataCacheReadAhead {
+    std::shared_ptr<DataCacheSource> source;
+    uint64 fileSize;
+    uint32 windowSize;
+    uint32 sequentialMisses;
+    uint32 current; // buffer that served the last request (the other one is being prefetched)
+    bool enabled;
+    bool stop;
+    ReadAheadBuffer buffers[2];
+    ReadAheadBuffer* job;
+    DataCacheStats stats; // reads done by the I/O thread (guarded by "lock")
+    std::mutex lock;
+    std::condition_variable jobAvailable, jobDone;
+    std::thread worker;
+
+    DataCacheReadAhead(std::shared_ptr<DataCacheSource> src, uint64 size, uint32 window)
+        : source(std::move(src)), fileSize(size), windowSize(window), sequentialMisses(0), current(0), enabled(true), stop(false), buffers{},
+          job(nullptr), stats{}
+    {
+    }
+    ~DataCacheReadAhead()
+    {
+        if (worker.joinable()) {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stop = true;
+            }
+            jobAvailable.notify_one();
+            worker.join();
+        }
+    }
+    bool Start()
+    {
+        if (worker.joinable())
+            return true;
+        for (auto& b : buffers) {
+            b.memory.reset(new (std::nothrow) uint8[(size_t) windowSize * 2]);
+            CHECK(b.memory, false, "Fail to allocate %u bytes for read-ahead", windowSize * 2);
+            b.data  = b.memory.get() + windowSize;
+            b.state = ReadAheadState::Empty;
+        }
+        worker = std::thread([this]() { Run(); });
+        return true;
+    }
+    void Run()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true) {
+            jobAvailable.wait(guard, [this]() { return stop || job != nullptr; });
+            if (stop)
+                return;
+            auto b = job;
+            job    = nullptr;
+            // the consumer never touches a pending buffer, so the read can be done without the lock
+            guard.unlock();
+            DataCacheStats readStats{};
+            auto ok = source->ReadAt(b->start, b->data, b->size, readStats);
+            guard.lock();
+            stats.refills += readStats.refills;
+            stats.bytesRead += readStats.bytesRead;
+            stats.readTime += readStats.readTime;
+            b->state = ok ? ReadAheadState::Ready : ReadAheadState::Failed;
+            jobDone.notify_all();
+        }
+    }
+    // all of the methods bellow expect "lock" to be held by the caller
+    void Schedule(ReadAheadBuffer& b, uint64 offset)
+    {
+        if ((offset >= fileSize) || (b.state == ReadAheadState::Pending))
+            return;
+        if ((b.state == ReadAheadState::Ready) && (b.start == offset))
+            return; // already there
+        b.start = offset;
+        b.size  = (uint32) std::min<uint64>(windowSize, fileSize - offset);
+        b.state = ReadAheadState::Pending;
+        job     = &b;
+        jobAvailable.notify_one();
+    }
+    void Wait(std::unique_lock<std::mutex>& guard, ReadAheadBuffer& b)
+    {
+        jobDone.wait(guard, [&b]() { return b.state != ReadAheadState::Pending; });
+    }
+    static bool Contains(const ReadAheadBuffer& b, uint64 offset, uint64 last)
+    {
+        return (b.state == ReadAheadState::Ready) && (offset >= b.start) && (last <= b.start + b.size);
+    }
+};
+
+static uint32 NormalizeCacheSize(uint32 cacheSize)
+{
+    cacheSize = (cacheSize | 0xFFFF) + 1; // a minimum of 64 K for cache
+    if (cacheSize == 0)
+        cacheSize = MAX_CACHE_SIZE;
+    return std::min(cacheSize, MAX_CACHE_SIZE);
+}
+static uint32 NormalizePageSize(uint32 pageSize, uint32 cacheSize)
+{
+    // page size must be a power of 2 (so that the cache size - multiple of 64K - is a multiple of it)
+    uint32 sz = MIN_PAGE_SIZE;
+    while ((sz < pageSize) && (sz < cacheSize))
+        sz <<= 1;
+    return std::min(sz, cacheSize);
+}
 
 DataCache::DataCache()
 {
-    this->fileObj    = nullptr;
-    this->cache      = nullptr;
-    this->cacheSize  = 0;
-    this->start      = 0;
-    this->end        = 0;
-    this->fileSize   = 0;
-    this->currentPos = 0;
+    this->cache            = nullptr;
+    this->window           = nullptr;
+    this->pages            = nullptr;
+    this->readAhead        = nullptr;
+    this->readAheadEnabled = true;
+    this->patchesBase      = 0;
+    this->cacheSize        = 0;
+    this->start            = 0;
+    this->end              = 0;
+    this->fileSize         = 0;
+    this->currentPos       = 0;
+    this->stats            = {};
 }
 DataCache::DataCache(DataCache&& obj)
 {
-    fileObj        = obj.fileObj;
-    fileSize       = obj.fileSize;
-    start          = obj.start;
-    end            = obj.end;
-    currentPos     = obj.currentPos;
-    cache          = obj.cache;
-    cacheSize      = obj.cacheSize;
-    obj.fileObj    = nullptr;
-    obj.fileSize   = 0;
-    obj.start      = 0;
-    obj.end        = 0;
-    obj.currentPos = 0;
-    obj.cache      = nullptr;
-    obj.cacheSize  = 0;
+    source           = std::move(obj.source);
+    memory           = std::move(obj.memory);
+    fileSize         = obj.fileSize;
+    start            = obj.start;
+    end              = obj.end;
+    currentPos       = obj.currentPos;
+    cache            = obj.cache;
+    window           = obj.window;
+    pages            = obj.pages;
+    readAhead        = obj.readAhead;
+    readAheadEnabled = obj.readAheadEnabled;
+    patches          = std::move(obj.patches);
+    patchesBase      = obj.patchesBase;
+    patched          = std::move(obj.patched);
+    cacheSize        = obj.cacheSize;
+    stats            = obj.stats;
+    obj.fileSize     = 0;
+    obj.start        = 0;
+    obj.end          = 0;
+    obj.currentPos   = 0;
+    obj.cache        = nullptr;
+    obj.window       = nullptr;
+    obj.pages        = nullptr;
+    obj.readAhead    = nullptr;
+    obj.cacheSize    = 0;
 }
 DataCache::~DataCache()
 {
-    if (this->fileObj)
-    {
-        this->fileObj->Close();
-        delete this->fileObj;
-    }
-    this->fileObj = nullptr;
+    // stop the I/O thread first (it may still be reading into its buffers)
+    if (this->readAhead)
+        delete reinterpret_cast<DataCacheReadAhead*>(this->readAhead);
+    this->readAhead = nullptr;
+    this->source.reset();
     if (this->cache)
         delete[] this->cache;
-    this->cache = nullptr;
+    this->cache  = nullptr;
+    this->window = nullptr;
+    if (this->pages)
+        delete reinterpret_cast<DataCachePages*>(this->pages);
+    this->pages = nullptr;
+    this->memory.reset();
 }
 
-bool DataCache::Init(std::unique_ptr<AppCUI::OS::DataObject> file, uint32 _cacheSize)
+bool DataCache::Init(std::unique_ptr<AppCUI::OS::DataObject> file, uint32 _cacheSize, uint32 pageSize)
 {
     CHECK(this->cacheSize == 0, false, "Cache object already initialized !");
-    this->fileObj = file.release(); // take ownership of the pointer
-    CHECK(this->fileObj, false, "Expecting a valid file object poiner !");
-    _cacheSize = (_cacheSize | 0xFFFF) + 1; // a minimum of 64 K for cache
-    if (_cacheSize == 0)
-        _cacheSize = MAX_CACHE_SIZE;
-    _cacheSize     = std::min(_cacheSize, MAX_CACHE_SIZE);
-    this->fileSize = fileObj->GetSize();
-
-    this->cache = new uint8[_cacheSize];
-    CHECK(this->cache, false, "Fail to allocate: %u bytes", _cacheSize);
+    CHECK(file, false, "Expecting a valid file object poiner !");
+    auto src = std::make_shared<DataCacheSource>();
+    auto sz  = file->GetSize();
+    src->obj = std::move(file); // take ownership of the pointer
+    return InitPages(std::move(src), sz, _cacheSize, pageSize);
+}
+bool DataCache::InitPages(std::shared_ptr<DataCacheSource> src, uint64 size, uint32 _cacheSize, uint32 pageSize)
+{
+    _cacheSize     = NormalizeCacheSize(_cacheSize);
+    pageSize       = NormalizePageSize(pageSize, _cacheSize);
+    this->fileSize = size;
+    this->source   = std::move(src);
+    this->patches  = std::make_shared<DataCachePatches>();
+
+    // one extra page so that any (unaligned) request of up to cacheSize bytes fits in consecutive slots
+    const auto slotsCount = _cacheSize / pageSize + 1;
+    this->cache           = new uint8[(size_t) slotsCount * pageSize];
+    CHECK(this->cache, false, "Fail to allocate: %u bytes", slotsCount * pageSize);
+
+    auto ctx      = new DataCachePages();
+    ctx->pageSize = pageSize;
+    ctx->tick     = 0;
+    ctx->slots.resize(slotsCount, CachePage{ INVALID_PAGE, 0 });
+    ctx->lookup.reserve(slotsCount);
+    this->pages = ctx;
+
+    // buffers and I/O thread are only created once a sequential scan is detected (and the file does not fit in the cache)
+    if (this->fileSize > _cacheSize)
+        this->readAhead = new DataCacheReadAhead(this->source, this->fileSize, _cacheSize);
+
     this->cacheSize = _cacheSize;
+    this->window    = this->cache;
     this->start     = 0;
     this->end       = 0;
 
     return true;
 }
+bool DataCache::Init(const std::filesystem::path& path, uint32 _cacheSize, bool useMemoryMapping, uint32 pageSize)
+{
+    CHECK(this->cacheSize == 0, false, "Cache object already initialized !");
+    if (useMemoryMapping) {
+        uint64 sz = 0;
+        auto view = FileMapping::Map(path, sz);
+        if (view)
+            return InitMemory(std::move(view), sz, _cacheSize);
+        LOG_INFO("Unable to map '%s' in memory, falling back to a cached read", path.u8string().c_str());
+    }
+    auto f = std::make_unique<AppCUI::OS::File>();
+    CHECK(f->OpenRead(path), false, "Fail to open file: %s", path.u8string().c_str());
+    return Init(std::move(f), _cacheSize, pageSize);
+}
+bool DataCache::Init(Buffer&& buffer, uint32 _cacheSize)
+{
+    CHECK(this->cacheSize == 0, false, "Cache object already initialized !");
+    CHECK(buffer.GetLength() > 0, false, "Expecting a non-empty buffer !");
+    // the buffer is kept alive by the shared pointer
+    auto owner = std::make_shared<Buffer>(std::move(buffer));
+    auto sz    = (uint64) owner->GetLength();
+    return InitMemory(std::shared_ptr<const uint8>(owner, owner->GetData()), sz, _cacheSize);
+}
+bool DataCache::Init(const DataCache& parent, uint64 offset, uint64 size, uint32 _cacheSize, uint32 pageSize)
+{
+    CHECK(this->cacheSize == 0, false, "Cache object already initialized !");
+    CHECK(size > 0, false, "Expecting a non-empty range !");
+    CHECK((offset < parent.fileSize) && (size <= parent.fileSize - offset), false, "Invalid range (offset: %llu, size: %llu)", offset, size);
+    if (parent.memory) {
+        CHECK(InitMemory(std::shared_ptr<const uint8>(parent.memory, parent.memory.get() + offset), size, _cacheSize), false, "");
+    } else {
+        CHECK(parent.source, false, "Parent cache was not properly initialized !");
+        auto src    = std::make_shared<DataCacheSource>();
+        src->parent = parent.source;
+        src->base   = offset;
+        CHECK(InitPages(std::move(src), size, _cacheSize, pageSize), false, "");
+    }
+    // the overlay of the parent is shared => the range shows (and changes) the modified bytes of the parent
+    this->patches     = parent.patches;
+    this->patchesBase = parent.patchesBase + offset;
+    return true;
+}
+DataCache DataCache::CreateReader(uint32 readerCacheSize, bool readAhead) const
+{
+    DataCache reader;
+    if (readerCacheSize == 0)
+        readerCacheSize = this->cacheSize;
+    if (this->memory) {
+        reader.InitMemory(this->memory, this->fileSize, readerCacheSize);
+    } else if (this->source) {
+        auto ctx = reinterpret_cast<const DataCachePages*>(this->pages);
+        if (!reader.InitPages(this->source, this->fileSize, readerCacheSize, ctx->pageSize))
+            LOG_ERROR("Fail to create a reader (cache size: %u)", readerCacheSize);
+    }
+    if (reader.cacheSize > 0) {
+        reader.patches     = this->patches;
+        reader.patchesBase = this->patchesBase;
+        reader.SetReadAhead(readAhead && this->readAheadEnabled);
+    }
+    return reader;
+}
+bool DataCache::InitMemory(std::shared_ptr<const uint8> content, uint64 size, uint32 _cacheSize)
+{
+    // the whole content is addressable => Get() returns views directly into it
+    // cacheSize is still set as it is used by callers to split large reads into chunks
+    this->memory    = std::move(content);
+    this->patches   = std::make_shared<DataCachePatches>();
+    this->fileSize  = size;
+    this->cacheSize = NormalizeCacheSize(_cacheSize);
+    this->window    = this->memory.get();
+    this->start     = 0;
+    this->end       = size;
+    return true;
+}
 BufferView DataCache::Get(uint64 offset, uint32 requestedSize, bool failIfRequestedSizeCanNotBeRead)
 {
-    CHECK(this->fileObj, BufferView(), "File was not properly initialized !");
     CHECK(requestedSize > 0, BufferView(), "'requestedSize' has to be bigger than 0 ");
+    this->stats.getCalls++;
+    auto b = GetOriginal(offset, requestedSize, failIfRequestedSizeCanNotBeRead);
+    if ((b.IsValid()) && (this->patches->patchedSize > 0))
+        return GetPatched(offset, b);
+    return b;
+}
+BufferView DataCache::GetPatched(uint64 offset, BufferView original)
+{
+    // only requests that touch a modified range are copied
+    if (!this->patches->Overlaps(this->patchesBase + offset, original.GetLength()))
+        return original;
+    this->patched.Resize(original.GetLength());
+    memcpy(this->patched.GetData(), original.GetData(), original.GetLength());
+    this->patches->Apply(this->patched.GetData(), this->patchesBase + offset, original.GetLength());
+    this->stats.bytesCopied += original.GetLength();
+    // GetFromCache() should return the modified bytes as well
+    this->window = this->patched.GetData();
+    this->start  = offset;
+    this->end    = offset + original.GetLength();
+    return BufferView(this->patched.GetData(), original.GetLength());
+}
+BufferView DataCache::GetOriginal(uint64 offset, uint32 requestedSize, bool failIfRequestedSizeCanNotBeRead)
+{
+    if (this->memory) {
+        if (offset >= this->fileSize)
+            return BufferView();
+        auto sz = requestedSize;
+        if (offset + sz > this->fileSize) {
+            if (failIfRequestedSizeCanNotBeRead)
+                return BufferView();
+            sz = (uint32) (this->fileSize - offset);
+        }
+        this->window     = this->memory.get();
+        this->start      = 0;
+        this->end        = this->fileSize;
+        this->currentPos = offset + sz;
+        this->stats.hits++;
+        return BufferView(this->memory.get() + offset, sz);
+    }
+    CHECK(this->source, BufferView(), "File was not properly initialized !");
 
-    if (offset >= this->start)
-    {
+    // (a window with patched data is never reused: the patches might have been changed by another reader)
+    if ((offset >= this->start) && (this->window != this->patched.GetData())) {
         // data is cached --> return from here
-        if ((offset + requestedSize) <= this->end)
-        {
+        if ((offset + requestedSize) <= this->end) {
             this->currentPos = offset + requestedSize;
-            return BufferView(&this->cache[offset - this->start], requestedSize);
+            this->stats.hits++;
+            return BufferView(&this->window[offset - this->start], requestedSize);
         }
-        if (this->end == this->fileSize)
-        {
+        if ((this->end == this->fileSize) && (offset < this->end)) {
             // data is not cache (and we are at the end of the file with the case)
             if (failIfRequestedSizeCanNotBeRead)
                 return BufferView();
             this->currentPos = this->fileSize;
-            return BufferView(&this->cache[offset - this->start], (uint32) (this->end - offset));
+            this->stats.hits++;
+            return BufferView(&this->window[offset - this->start], (uint32) (this->end - offset));
         }
     }
     // request outside file
     if (offset >= this->fileSize)
         return BufferView();
-    // data is not available in cache ==> read it
-    uint64 _start, _end;
-    if (this->fileSize <= this->cacheSize)
-    {
+    if ((failIfRequestedSizeCanNotBeRead) && (offset + requestedSize > this->fileSize))
+        return BufferView();
+
+    // forward sequential access (each request starts where the previous one ended) ==> use the read-ahead buffers
+    if (this->readAhead) {
+        auto ra = reinterpret_cast<DataCacheReadAhead*>(this->readAhead);
+        if ((ra->enabled) && (offset == this->currentPos) && (requestedSize <= this->cacheSize)) {
+            if (ra->sequentialMisses < READ_AHEAD_TRIGGER)
+                ra->sequentialMisses++;
+            if (ra->sequentialMisses >= READ_AHEAD_TRIGGER) {
+                auto b = GetSequential(offset, requestedSize);
+                if (b.IsValid())
+                    return b;
+            }
+        } else {
+            ra->sequentialMisses = 0;
+        }
+    }
+
+    // data is not available in cache ==> find (or load) the pages that contain it
+    auto ctx       = reinterpret_cast<DataCachePages*>(this->pages);
+    auto pageSize  = (uint64) ctx->pageSize;
+    uint64 firstPage, pagesCount;
+    if (this->fileSize <= this->cacheSize) {
         // read everything
-        _start = 0;
-        _end   = this->fileSize;
+        firstPage  = 0;
+        pagesCount = (this->fileSize + pageSize - 1) / pageSize;
+    } else {
+        // at most cacheSize bytes can be served at once (the extra slot covers the unaligned part)
+        auto last  = std::min<>(std::min<>(offset + requestedSize, this->fileSize), offset + this->cacheSize);
+        firstPage  = offset / pageSize;
+        pagesCount = (last - 1) / pageSize - firstPage + 1;
     }
-    else
-    {
-        // compute the new buffer to read
-        auto sz = requestedSize;
-        if ((offset + sz) > this->fileSize)
-            sz = (uint32) (this->fileSize - offset);
-        if (sz > this->cacheSize)
-            sz = this->cacheSize;
-        auto diff = this->cacheSize - sz;
-        if (diff <= offset)
-            _start = offset - diff;
-        else
-            _start = 0;
-        _end = _start + this->cacheSize;
-        if (_end > this->fileSize)
-            _end = this->fileSize;
-    }
-    // read new data in cache
-    if (this->fileObj->SetCurrentPos(_start) == false)
-        return BufferView();
-    if (this->fileObj->Read(this->cache, (uint32) (_end - _start)) == false)
-    {
+    auto slot = LoadPages(firstPage, (uint32) pagesCount);
+    if (slot == INVALID_SLOT) {
         this->start = 0;
         this->end   = 0;
         return BufferView();
     }
     // return new pointer
-    this->start = _start;
-    this->end   = _end;
-    if ((offset + requestedSize) <= this->end)
-    {
+    this->start  = firstPage * pageSize;
+    this->end    = std::min<>((firstPage + pagesCount) * pageSize, this->fileSize);
+    this->window = this->cache + (uint64) slot * pageSize;
+    if ((offset + requestedSize) <= this->end) {
         this->currentPos = offset + requestedSize;
-        return BufferView(&this->cache[offset - this->start], requestedSize);
+        return BufferView(&this->window[offset - this->start], requestedSize);
     }
     // the entire data is not in our cache
     if (failIfRequestedSizeCanNotBeRead)
         return BufferView();
-    if (this->end == this->fileSize)
-    {
+    if (this->end == this->fileSize) {
         this->currentPos = this->fileSize;
-        return BufferView(&this->cache[offset - this->start], (uint32) (this->end - offset));
+        return BufferView(&this->window[offset - this->start], (uint32) (this->end - offset));
     }
     this->currentPos = this->end;
-    return BufferView(&this->cache[offset - this->start], (uint32) (this->end - offset));
+    return BufferView(&this->window[offset - this->start], (uint32) (this->end - offset));
+}
+bool DataCache::ReadPages(uint64 firstPage, uint32 count, uint32 slot)
+{
+    auto ctx      = reinterpret_cast<DataCachePages*>(this->pages);
+    auto pageSize = (uint64) ctx->pageSize;
+    auto offset   = firstPage * pageSize;
+    auto size     = (uint32) std::min<>((uint64) count * pageSize, this->fileSize - offset);
+
+    return this->source->ReadAt(offset, this->cache + (uint64) slot * pageSize, size, this->stats);
+}
+BufferView DataCache::GetSequential(uint64 offset, uint32 requestedSize)
+{
+    auto ra = reinterpret_cast<DataCacheReadAhead*>(this->readAhead);
+    CHECK(ra->Start(), BufferView(), "");
+
+    const auto last = std::min<uint64>(offset + requestedSize, this->fileSize);
+    std::unique_lock<std::mutex> guard(ra->lock);
+    auto* cur = &ra->buffers[ra->current];
+    auto* nxt = &ra->buffers[ra->current ^ 1];
+    const uint8* data;
+
+    // the request continues in the buffer that is being prefetched ==> wait for it
+    if ((nxt->state == ReadAheadState::Pending) && (offset < nxt->start + nxt->size) && (last > nxt->start))
+        ra->Wait(guard, *nxt);
+
+    if (DataCacheReadAhead::Contains(*cur, offset, last)) {
+        data = cur->data + (offset - cur->start);
+        this->stats.hits++;
+    } else if (DataCacheReadAhead::Contains(*nxt, offset, last)) {
+        std::swap(cur, nxt);
+        ra->current ^= 1;
+        data = cur->data + (offset - cur->start);
+        this->stats.hits++;
+    } else if (
+          (DataCacheReadAhead::Contains(*cur, offset, offset + 1)) && (nxt->state == ReadAheadState::Ready) && (nxt->start == cur->start + cur->size) &&
+          (last <= nxt->start + nxt->size)) {
+        // the request crosses the boundary between the two buffers ==> move the tail of the current one in front of the next one
+        const auto tail = (size_t) (nxt->start - offset);
+        memcpy(nxt->data - tail, cur->data + (offset - cur->start), tail);
+        std::swap(cur, nxt);
+        ra->current ^= 1;
+        data = cur->data - tail;
+        this->stats.hits++;
+    } else {
+        // nothing usable was prefetched ==> read synchronously (the other buffer can not be touched while it is pending)
+        if (nxt->state == ReadAheadState::Pending)
+            ra->Wait(guard, *nxt);
+        cur->start = offset;
+        cur->size  = (uint32) std::min<uint64>(ra->windowSize, this->fileSize - offset);
+        cur->state = ReadAheadState::Failed;
+        guard.unlock();
+        this->stats.misses++;
+        const auto ok = this->source->ReadAt(cur->start, cur->data, cur->size, this->stats);
+        guard.lock();
+        if (!ok)
+            return BufferView();
+        cur->state = ReadAheadState::Ready;
+        data       = cur->data;
+    }
+    // start reading the next window while the current one is being processed
+    ra->Schedule(*nxt, cur->start + cur->size);
+
+    this->window     = data;
+    this->start      = offset;
+    this->end        = cur->start + cur->size;
+    this->currentPos = last;
+    return BufferView(data, (size_t) (last - offset));
+}
+DataCacheStats DataCache::GetStatistics() const
+{
+    auto result = this->stats;
+    if (this->readAhead) {
+        auto ra = reinterpret_cast<DataCacheReadAhead*>(this->readAhead);
+        std::lock_guard<std::mutex> guard(ra->lock);
+        result.refills += ra->stats.refills;
+        result.bytesRead += ra->stats.bytesRead;
+        result.readTime += ra->stats.readTime;
+    }
+    return result;
+}
+void DataCache::LogStatistics([[maybe_unused]] std::string_view name) const
+{
+    [[maybe_unused]] const auto s = GetStatistics(); // logging might be disabled
+    LOG_INFO(
+          "Cache statistics for '%.*s': Get calls: %llu, hits: %llu, misses: %llu, refills: %llu, bytes read: %llu, bytes copied: %llu, read time: %llu us",
+          (int) name.size(),
+          name.data(),
+          s.getCalls,
+          s.hits,
+          s.misses,
+          s.refills,
+          s.bytesRead,
+          s.bytesCopied,
+          s.readTime);
+}
+void DataCache::SetReadAhead(bool enabled)
+{
+    this->readAheadEnabled = enabled;
+    if (this->readAhead) {
+        auto ra              = reinterpret_cast<DataCacheReadAhead*>(this->readAhead);
+        ra->enabled          = enabled;
+        ra->sequentialMisses = 0;
+    }
+}
+uint32 DataCache::LoadPages(uint64 firstPage, uint32 count)
+{
+    auto ctx = reinterpret_cast<DataCachePages*>(this->pages);
+    auto& slots = ctx->slots;
+    auto slotsCount = (uint32) slots.size();
+    CHECK(count > 0 && count <= slotsCount, INVALID_SLOT, "Invalid number of pages: %u", count);
+    ctx->tick++;
+
+    // already cached in consecutive slots ==> nothing to read
+    auto it = ctx->lookup.find(firstPage);
+    if (it != ctx->lookup.end()) {
+        auto slot = it->second;
+        auto idx  = 1U;
+        if (slot + count <= slotsCount) {
+            while ((idx < count) && (slots[slot + idx].page == firstPage + idx))
+                idx++;
+        }
+        if (idx == count) {
+            for (idx = 0; idx < count; idx++)
+                slots[slot + idx].lastUsed = ctx->tick;
+            this->stats.hits++;
+            return slot;
+        }
+    }
+
+    // pick the least recently used group of "count" consecutive slots
+    auto dest = 0U;
+    if (count == 1) {
+        for (auto idx = 1U; idx < slotsCount; idx++) {
+            if (slots[idx].lastUsed < slots[dest].lastUsed)
+                dest = idx;
+        }
+    } else {
+        uint64 sum = 0;
+        for (auto idx = 0U; idx < count; idx++)
+            sum += slots[idx].lastUsed;
+        auto best = sum;
+        for (auto idx = count; idx < slotsCount; idx++) {
+            sum = sum + slots[idx].lastUsed - slots[idx - count].lastUsed;
+            if (sum < best) {
+                best = sum;
+                dest = idx - count + 1;
+            }
+        }
+    }
+
+    // evict the pages from the destination slots and the requested pages that are cached somewhere else
+    // (pages are stitched together by reading the whole range in the destination slots)
+    for (auto idx = 0U; idx < count; idx++) {
+        auto& s = slots[dest + idx];
+        if (s.page != INVALID_PAGE) {
+            ctx->lookup.erase(s.page);
+            s.page     = INVALID_PAGE;
+            s.lastUsed = 0;
+        }
+        auto prev = ctx->lookup.find(firstPage + idx);
+        if (prev != ctx->lookup.end()) {
+            slots[prev->second].page     = INVALID_PAGE;
+            slots[prev->second].lastUsed = 0;
+            ctx->lookup.erase(prev);
+        }
+    }
+    this->stats.misses++;
+    CHECK(ReadPages(firstPage, count, dest), INVALID_SLOT, "");
+    for (auto idx = 0U; idx < count; idx++) {
+        slots[dest + idx].page     = firstPage + idx;
+        slots[dest + idx].lastUsed = ctx->tick;
+        ctx->lookup[firstPage + idx] = dest + idx;
+    }
+    return dest;
 }
 bool DataCache::CopyObject(void* buffer, uint64 offset, uint32 requestedSize)
 {
@@ -147,6 +756,7 @@ bool DataCache::CopyObject(void* buffer, uint64 offset, uint32 requestedSize)
     auto b = Get(offset, requestedSize, true);
     CHECK(b.IsValid(), false, "Unable to read %u bytes from %llu offset ", requestedSize, offset);
     memcpy(buffer, b.GetData(), b.GetLength());
+    this->stats.bytesCopied += b.GetLength();
     return true;
 }
 Buffer DataCache::CopyToBuffer(uint64 offset, uint32 requestedSize, bool failIfRequestedSizeCanNotBeRead)
@@ -160,6 +770,18 @@ Buffer DataCache::CopyToBuffer(uint64 offset, uint32 requestedSize, bool failIfR
     }
 
     Buffer b{};
+    if (this->memory) {
+        // no need to go through the cache, copy everything at once
+        auto sz = (uint32) std::min<uint64>(requestedSize, this->fileSize - offset);
+        b.Resize(sz);
+        if (sz > 0) {
+            memcpy(b.GetData(), this->memory.get() + offset, sz);
+            if (this->patches->patchedSize > 0)
+                this->patches->Apply(b.GetData(), this->patchesBase + offset, sz);
+        }
+        this->stats.bytesCopied += sz;
+        return b;
+    }
     b.Resize(requestedSize);
     uint32 toRead = this->cacheSize >> 1;
     auto p        = b.GetData();
@@ -185,6 +807,7 @@ Buffer DataCache::CopyToBuffer(uint64 offset, uint32 requestedSize, bool failIfR
             if (bv.GetLength() > 0)
             {
                 memcpy(p, bv.GetData(), bv.GetLength());
+                this->stats.bytesCopied += bv.GetLength();
             }
             p += bv.GetLength();
             // trim the buffer size to the amount of data that was read
@@ -192,6 +815,7 @@ Buffer DataCache::CopyToBuffer(uint64 offset, uint32 requestedSize, bool failIfR
             return b;
         }
         memcpy(p, bv.GetData(), toRead);
+        this->stats.bytesCopied += toRead;
         p += toRead;
         offset += toRead;
         requestedSize -= toRead;
@@ -218,3 +842,62 @@ bool DataCache::WriteTo(Reference<AppCUI::OS::DataObject> output, uint64 offset,
     }
     return true;
 }
+bool DataCache::Patch(uint64 offset, BufferView data)
+{
+    CHECK(this->patches, false, "Cache object was not initialized !");
+    CHECK((data.IsValid()) && (data.GetLength() > 0), false, "Expecting a non-empty buffer !");
+    CHECK((offset < this->fileSize) && (data.GetLength() <= this->fileSize - offset),
+          false,
+          "Can not patch %u bytes at offset %llu (data size is %llu)",
+          (uint32) data.GetLength(),
+          offset,
+          this->fileSize);
+    this->patches->Add(this->patchesBase + offset, data);
+    this->patches->version++;
+    // the last window might contain the previous values
+    this->start = 0;
+    this->end   = 0;
+    return true;
+}
+void DataCache::ClearPatches()
+{
+    if (this->patches) {
+        this->patches->Remove(this->patchesBase, this->fileSize);
+        this->patches->version++;
+        this->start = 0;
+        this->end   = 0;
+    }
+}
+bool DataCache::HasPatches() const
+{
+    return (this->patches) && (this->patches->patchedSize > 0) && (this->patches->Overlaps(this->patchesBase, this->fileSize));
+}
+uint64 DataCache::GetPatchedSize() const
+{
+    return this->patches ? this->patches->Count(this->patchesBase, this->fileSize) : 0;
+}
+uint64 DataCache::GetPatchesVersion() const
+{
+    return this->patches ? this->patches->version.load() : 0;
+}
+bool DataCache::SaveAs(const std::filesystem::path& path)
+{
+    CHECK(this->cacheSize > 0, false, "Cache object was not initialized !");
+    // the content might be read from "path" ==> write a temporary file first and replace the destination at the end
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    AppCUI::OS::File f;
+    CHECK(f.Create(tmpPath, true), false, "Fail to create: %s", tmpPath.u8string().c_str());
+    auto ok = ForEachChunk(0, this->fileSize, 0, 0, [&f](uint64, BufferView chunk) { return f.Write(chunk.GetData(), (uint32) chunk.GetLength()); });
+    f.Close();
+    std::error_code ec;
+    if (ok) {
+        std::filesystem::rename(tmpPath, path, ec);
+        ok = !ec;
+    }
+    if (!ok) {
+        std::filesystem::remove(tmpPath, ec);
+        RETURNERROR(false, "Fail to save the content to: %s", path.u8string().c_str());
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+#include "Internal.hpp"
+
+#ifdef BUILD_FOR_WINDOWS
+#    include <Windows.h>
+#    undef GetObject
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace GView::Utils::FileMapping
+{
+std::shared_ptr<const uint8> Map(const std::filesystem::path& path, uint64& size)
+{
+    size = 0;
+#ifdef BUILD_FOR_WINDOWS
+    auto hFile = CreateFileW(
+          path.wstring().c_str(),
+          GENERIC_READ,
+          FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+          nullptr,
+          OPEN_EXISTING,
+          FILE_ATTRIBUTE_NORMAL,
+          nullptr);
+    CHECK(hFile != INVALID_HANDLE_VALUE, nullptr, "Fail to open file for mapping (error: %u)", GetLastError());
+
+    LARGE_INTEGER fileSize;
+    if ((GetFileSizeEx(hFile, &fileSize) == FALSE) || (fileSize.QuadPart <= 0) || ((uint64) fileSize.QuadPart > (uint64) SIZE_MAX)) {
+        CloseHandle(hFile);
+        RETURNERROR(nullptr, "File is empty or too large to be mapped in the current address space");
+    }
+
+    auto hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // the mapping object keeps its own reference to the file
+    CloseHandle(hFile);
+    CHECK(hMapping != nullptr, nullptr, "Fail to create file mapping (error: %u)", GetLastError());
+
+    auto ptr = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    // the view keeps the mapping object alive until UnmapViewOfFile is called
+    CloseHandle(hMapping);
+    CHECK(ptr != nullptr, nullptr, "Fail to map view of file (error: %u)", GetLastError());
+
+    size = (uint64) fileSize.QuadPart;
+    return std::shared_ptr<const uint8>(reinterpret_cast<const uint8*>(ptr), [](const uint8* p) { UnmapViewOfFile(p); });
+#else
+    auto fd = open(path.c_str(), O_RDONLY);
+    CHECK(fd >= 0, nullptr, "Fail to open file for mapping");
+
+    struct stat st;
+    if ((fstat(fd, &st) != 0) || (!S_ISREG(st.st_mode)) || (st.st_size <= 0) || ((uint64) st.st_size > (uint64) SIZE_MAX)) {
+        close(fd);
+        RETURNERROR(nullptr, "Only regular, non-empty files that fit in the address space can be mapped");
+    }
+
+    const auto length = static_cast<size_t>(st.st_size);
+    auto ptr          = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps its own reference to the file
+    close(fd);
+    CHECK(ptr != MAP_FAILED, nullptr, "Fail to map file in memory");
+
+    size = (uint64) st.st_size;
+    return std::shared_ptr<const uint8>(reinterpret_cast<const uint8*>(ptr), [length](const uint8* p) { munmap(const_cast<uint8*>(p), length); });
+#endif
+}
+} // namespace GView::Utils::FileMapping
@@ -0,0 +1,298 @@
+#include "GView.hpp"
+
+using namespace GView::Utils;
+
+struct InternalJSONWriter
+{
+    struct Scope
+    {
+        bool isArray;
+        bool hasItems;
+    };
+    std::string text;
+    std::vector<Scope> scopes;
+};
+
+static void JSONWriter_AddEscapedChar(std::string& text, uint32 ch)
+{
+    switch (ch)
+    {
+    case '"':
+        text += "\\\"";
+        return;
+    case '\\':
+        text += "\\\\";
+        return;
+    case '\n':
+        text += "\\n";
+        return;
+    case '\r':
+        text += "\\r";
+        return;
+    case '\t':
+        text += "\\t";
+        return;
+    }
+    if (ch < 0x20)
+    {
+        char tmp[8];
+        snprintf(tmp, sizeof(tmp), "\\u%04X", static_cast<uint16>(ch));
+        text += tmp;
+        return;
+    }
+    // UTF-8 encoding
+    if (ch < 0x80)
+    {
+        text += static_cast<char>(ch);
+    }
+    else if (ch < 0x800)
+    {
+        text += static_cast<char>(0xC0 | (ch >> 6));
+        text += static_cast<char>(0x80 | (ch & 0x3F));
+    }
+    else if (ch < 0x10000)
+    {
+        text += static_cast<char>(0xE0 | (ch >> 12));
+        text += static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (ch & 0x3F));
+    }
+    else
+    {
+        text += static_cast<char>(0xF0 | (ch >> 18));
+        text += static_cast<char>(0x80 | ((ch >> 12) & 0x3F));
+        text += static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (ch & 0x3F));
+    }
+}
+static uint32 JSONWriter_DecodeUTF8(const uint8* p, const uint8* e, uint32& ch)
+{
+    // returns the size of a valid UTF-8 sequence (or 0 if the sequence is not valid)
+    uint32 size;
+    if (*p < 0xC2)
+        return 0;
+    if (*p < 0xE0)
+    {
+        size = 2;
+        ch   = (*p) & 0x1F;
+    }
+    else if (*p < 0xF0)
+    {
+        size = 3;
+        ch   = (*p) & 0x0F;
+    }
+    else if (*p < 0xF5)
+    {
+        size = 4;
+        ch   = (*p) & 0x07;
+    }
+    else
+    {
+        return 0;
+    }
+    if (p + size > e)
+        return 0;
+    for (uint32 index = 1; index < size; index++)
+    {
+        if ((p[index] & 0xC0) != 0x80)
+            return 0;
+        ch = (ch << 6) | (p[index] & 0x3F);
+    }
+    // overlong encodings, surrogates and values outside the unicode range are not valid
+    if (((size == 3) && (ch < 0x800)) || ((size == 4) && ((ch < 0x10000) || (ch > 0x10FFFF))) || ((ch >= 0xD800) && (ch <= 0xDFFF)))
+        return 0;
+    return size;
+}
+static void JSONWriter_AddString(std::string& text, std::string_view value)
+{
+    text += '"';
+    auto p = reinterpret_cast<const uint8*>(value.data());
+    auto e = p + value.size();
+    while (p < e)
+    {
+        if (*p < 0x80)
+        {
+            JSONWriter_AddEscapedChar(text, *p);
+            p++;
+            continue;
+        }
+        uint32 ch;
+        auto size = JSONWriter_DecodeUTF8(p, e, ch);
+        if (size == 0)
+        {
+            // not a valid UTF-8 sequence => the byte is considered to be a Latin-1 character
+            JSONWriter_AddEscapedChar(text, *p);
+            p++;
+        }
+        else
+        {
+            text.append(reinterpret_cast<const char*>(p), size);
+            p += size;
+        }
+    }
+    text += '"';
+}
+static void JSONWriter_AddString(std::string& text, std::u16string_view value)
+{
+    text += '"';
+    auto p = value.data();
+    auto e = p + value.size();
+    while (p < e)
+    {
+        uint32 ch = *p;
+        p++;
+        if ((ch >= 0xD800) && (ch <= 0xDBFF) && (p < e) && ((*p) >= 0xDC00) && ((*p) <= 0xDFFF))
+        {
+            ch = 0x10000 + ((ch - 0xD800) << 10) + ((*p) - 0xDC00);
+            p++;
+        }
+        else if ((ch >= 0xD800) && (ch <= 0xDFFF))
+        {
+            ch = 0xFFFD; // unpaired surrogate
+        }
+        JSONWriter_AddEscapedChar(text, ch);
+    }
+    text += '"';
+}
+static InternalJSONWriter* JSONWriter_AddKey(void*& data, std::string_view key)
+{
+    if (!data)
+        data = new InternalJSONWriter();
+    auto jw = reinterpret_cast<InternalJSONWriter*>(data);
+    if (jw->scopes.empty())
+    {
+        // only one value (object or array) can be added at the top level
+        CHECK(jw->text.empty(), nullptr, "A JSON text can only have one root value !");
+        return jw;
+    }
+    auto& scope = jw->scopes.back();
+    if (scope.hasItems)
+        jw->text += ',';
+    scope.hasItems = true;
+    if (!scope.isArray)
+    {
+        JSONWriter_AddString(jw->text, key);
+        jw->text += ':';
+    }
+    return jw;
+}
+
+JSONWriter::JSONWriter()
+{
+    data = nullptr;
+}
+JSONWriter::~JSONWriter()
+{
+    if (data)
+    {
+        auto jw = reinterpret_cast<InternalJSONWriter*>(data);
+        delete jw;
+        data = nullptr;
+    }
+}
+void JSONWriter::Clear()
+{
+    if (!data)
+        return;
+    auto jw = reinterpret_cast<InternalJSONWriter*>(data);
+    jw->text.clear();
+    jw->scopes.clear();
+}
+bool JSONWriter::BeginObject(std::string_view key)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw, false, "");
+    jw->text += '{';
+    jw->scopes.push_back({ false, false });
+    return true;
+}
+bool JSONWriter::EndObject()
+{
+    CHECK(data, false, "");
+    auto jw = reinterpret_cast<InternalJSONWriter*>(data);
+    CHECK((!jw->scopes.empty()) && (!jw->scopes.back().isArray), false, "No JSON object to close !");
+    jw->scopes.pop_back();
+    jw->text += '}';
+    return true;
+}
+bool JSONWriter::BeginArray(std::string_view key)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw, false, "");
+    jw->text += '[';
+    jw->scopes.push_back({ true, false });
+    return true;
+}
+bool JSONWriter::EndArray()
+{
+    CHECK(data, false, "");
+    auto jw = reinterpret_cast<InternalJSONWriter*>(data);
+    CHECK((!jw->scopes.empty()) && (jw->scopes.back().isArray), false, "No JSON array to close !");
+    jw->scopes.pop_back();
+    jw->text += ']';
+    return true;
+}
+bool JSONWriter::AddString(std::string_view key, std::string_view value)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw && !jw->scopes.empty(), false, "Values must be added in an object or an array !");
+    JSONWriter_AddString(jw->text, value);
+    return true;
+}
+bool JSONWriter::AddString(std::string_view key, std::u16string_view value)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw && !jw->scopes.empty(), false, "Values must be added in an object or an array !");
+    JSONWriter_AddString(jw->text, value);
+    return true;
+}
+bool JSONWriter::AddNumber(std::string_view key, uint64 value)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw && !jw->scopes.empty(), false, "Values must be added in an object or an array !");
+    jw->text += std::to_string(value);
+    return true;
+}
+bool JSONWriter::AddSignedNumber(std::string_view key, int64 value)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw && !jw->scopes.empty(), false, "Values must be added in an object or an array !");
+    jw->text += std::to_string(value);
+    return true;
+}
+bool JSONWriter::AddBool(std::string_view key, bool value)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw && !jw->scopes.empty(), false, "Values must be added in an object or an array !");
+    jw->text += value ? "true" : "false";
+    return true;
+}
+bool JSONWriter::AddNull(std::string_view key)
+{
+    auto jw = JSONWriter_AddKey(data, key);
+    CHECK(jw && !jw->scopes.empty(), false, "Values must be added in an object or an array !");
+    jw->text += "null";
+    return true;
+}
+uint32 JSONWriter::GetLevel() const
+{
+    if (!data)
+        return 0;
+    return static_cast<uint32>(reinterpret_cast<InternalJSONWriter*>(data)->scopes.size());
+}
+void JSONWriter::Close(uint32 level)
+{
+    if (!data)
+        return;
+    auto jw = reinterpret_cast<InternalJSONWriter*>(data);
+    while (jw->scopes.size() > level)
+    {
+        jw->text += jw->scopes.back().isArray ? ']' : '}';
+        jw->scopes.pop_back();
+    }
+}
+std::string_view JSONWriter::GetText() const
+{
+    if (!data)
+        return {};
+    return reinterpret_cast<InternalJSONWriter*>(data)->text;
+}
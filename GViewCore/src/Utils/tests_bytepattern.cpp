@@ -0,0 +1,281 @@
+#include <catch.hpp>
+#include "Internal.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace GView::Utils;
+
+// deterministic values (splitmix64)
+struct SplitMix64
+{
+    uint64 state;
+
+    uint64 Next()
+    {
+        uint64 z = (state += 0x9E3779B97F4A7C15ULL);
+        z        = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z        = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    uint32 Next(uint32 limit)
+    {
+        return static_cast<uint32>(Next() % limit);
+    }
+};
+
+struct TestPattern
+{
+    std::vector<uint8> bytes;
+    std::vector<uint8> mask;
+    bool ignoreCase;
+};
+
+static inline bool IsLetter(uint8 value)
+{
+    return ((value >= 'a') && (value <= 'z')) || ((value >= 'A') && (value <= 'Z'));
+}
+static inline uint8 ToLower(uint8 value)
+{
+    return ((value >= 'A') && (value <= 'Z')) ? static_cast<uint8>(value + 32) : value;
+}
+
+// reference: every position is compared byte by byte (the definition of a match)
+static bool MatchesAt(const TestPattern& pattern, const std::vector<uint8>& input, size_t offset)
+{
+    for (size_t i = 0; i < pattern.bytes.size(); i++)
+    {
+        if (pattern.mask[i] == BytePattern::ANY)
+            continue;
+        if ((pattern.ignoreCase) && (IsLetter(pattern.bytes[i])))
+        {
+            if (ToLower(input[offset + i]) != ToLower(pattern.bytes[i]))
+                return false;
+        }
+        else if (input[offset + i] != pattern.bytes[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+static std::vector<size_t> FindAllNaive(const TestPattern& pattern, const std::vector<uint8>& input, uint32 alignment = 1)
+{
+    std::vector<size_t> positions;
+    for (size_t offset = 0; offset + pattern.bytes.size() <= input.size(); offset += alignment)
+    {
+        if (MatchesAt(pattern, input, offset))
+            positions.push_back(offset);
+    }
+    return positions;
+}
+static std::vector<size_t> FindAll(const BytePattern& searcher, const std::vector<uint8>& input, size_t start = 0)
+{
+    std::vector<size_t> positions;
+    size_t position = 0;
+    while (searcher.Find(BufferView(input.data(), input.size()), start, position))
+    {
+        REQUIRE(position >= start);
+        positions.push_back(position);
+        start = position + 1;
+    }
+    return positions;
+}
+static void InitSearcher(BytePattern& searcher, const TestPattern& pattern)
+{
+    REQUIRE(searcher.Init(
+          BufferView(pattern.bytes.data(), pattern.bytes.size()), BufferView(pattern.mask.data(), pattern.mask.size()), pattern.ignoreCase));
+    REQUIRE(searcher.GetLength() == pattern.bytes.size());
+}
+
+// a small alphabet (letters in both cases, zeros, 0xFF) => the random patterns are found in the random input
+static constexpr uint8 ALPHABET[] = { 'a', 'A', 'b', 'B', 'z', 'Z', 0x00, 0xFF, 0x40, 0x60 };
+
+static uint8 NextByte(SplitMix64& random)
+{
+    return ALPHABET[random.Next(sizeof(ALPHABET))];
+}
+static TestPattern CreatePattern(SplitMix64& random, uint32 length, bool wildcards, bool ignoreCase)
+{
+    TestPattern pattern{ {}, {}, ignoreCase };
+    for (uint32 i = 0; i < length; i++)
+    {
+        pattern.bytes.push_back(NextByte(random));
+        pattern.mask.push_back((wildcards) && (random.Next(4) == 0) ? BytePattern::ANY : BytePattern::EXACT);
+    }
+    // at least one byte that is not a wildcard
+    pattern.mask[random.Next(length)] = BytePattern::EXACT;
+    return pattern;
+}
+
+constexpr uint32 MAX_PATTERN_LENGTH = 64;
+constexpr uint32 MAX_TAIL           = 48; // more than a vector of positions (16) + the scalar tail
+
+TEST_CASE("BytePatternRandom", "[Utils]BytePattern")
+{
+    SplitMix64 random{ 1 };
+    for (uint32 length = 1; length <= MAX_PATTERN_LENGTH; length++)
+    {
+        for (auto iteration = 0U; iteration < 8; iteration++)
+        {
+            const auto pattern = CreatePattern(random, length, (iteration & 1) != 0, (iteration & 2) != 0);
+            BytePattern searcher;
+            InitSearcher(searcher, pattern);
+
+            // the input contains copies of the pattern (with the case of the letters changed) at random positions
+            std::vector<uint8> input(4096 + random.Next(64));
+            for (auto& value : input)
+                value = NextByte(random);
+            for (auto copies = 0U; copies < 16; copies++)
+            {
+                const auto offset = random.Next(static_cast<uint32>(input.size() - length + 1));
+                for (uint32 i = 0; i < length; i++)
+                {
+                    auto value = pattern.bytes[i];
+                    if ((pattern.ignoreCase) && (IsLetter(value)) && (random.Next(2) == 0))
+                        value ^= 0x20;
+                    input[offset + i] = value;
+                }
+            }
+            REQUIRE(FindAll(searcher, input) == FindAllNaive(pattern, input));
+            const auto start = random.Next(static_cast<uint32>(input.size()));
+            auto expected    = FindAllNaive(pattern, input);
+            expected.erase(expected.begin(), std::lower_bound(expected.begin(), expected.end(), start));
+            REQUIRE(FindAll(searcher, input, start) == expected);
+        }
+    }
+}
+
+TEST_CASE("BytePatternTail", "[Utils]BytePattern")
+{
+    // a single match at every position close to the end of the input (the positions that do not fill a vector)
+    SplitMix64 random{ 2 };
+    for (uint32 length = 1; length <= MAX_PATTERN_LENGTH; length++)
+    {
+        const auto pattern = CreatePattern(random, length, (length & 1) != 0, (length & 2) != 0);
+        BytePattern searcher;
+        InitSearcher(searcher, pattern);
+        for (uint32 size = length; size <= length + MAX_TAIL; size++)
+        {
+            for (uint32 offset = 0; offset + length <= size; offset++)
+            {
+                // 0x01 is not in the alphabet => it never matches a byte of the pattern that is not a wildcard
+                std::vector<uint8> input(size, 0x01);
+                std::copy(pattern.bytes.begin(), pattern.bytes.end(), input.begin() + offset);
+                auto expected = FindAllNaive(pattern, input);
+                REQUIRE(FindAll(searcher, input) == expected);
+                expected.erase(expected.begin(), std::lower_bound(expected.begin(), expected.end(), offset));
+                REQUIRE(FindAll(searcher, input, offset) == expected);
+            }
+            // no match
+            std::vector<uint8> input(size, 0x01);
+            size_t position = 0;
+            REQUIRE(searcher.Find(BufferView(input.data(), input.size()), 0, position) == false);
+        }
+        // shorter than the pattern or a start after the last possible match
+        std::vector<uint8> input(pattern.bytes.begin(), pattern.bytes.end());
+        size_t position = 0;
+        REQUIRE(searcher.Find(BufferView(input.data(), input.size() - 1), 0, position) == false);
+        REQUIRE(searcher.Find(BufferView(input.data(), input.size()), 1, position) == false);
+        REQUIRE(searcher.Find(BufferView(input.data(), input.size()), 0, position));
+        REQUIRE(position == 0);
+    }
+}
+
+TEST_CASE("BytePatternHorspool", "[Utils]BytePattern")
+{
+    // the two rare bytes of the pattern ('Q', 'Z') are found at every other position of the input, but the last byte is not =>
+    // the prefilter has mostly false positives and the search continues with Horspool
+    TestPattern pattern{ {}, {}, false };
+    for (auto i = 0U; i < 16; i++)
+    {
+        pattern.bytes.push_back('Q');
+        pattern.bytes.push_back('Z');
+    }
+    pattern.bytes.push_back('x');
+    pattern.mask.resize(pattern.bytes.size(), BytePattern::EXACT);
+    BytePattern searcher;
+    InitSearcher(searcher, pattern);
+
+    SplitMix64 random{ 3 };
+    for (auto iteration = 0U; iteration < 64; iteration++)
+    {
+        std::vector<uint8> input(0x4000 + random.Next(0x100));
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (i & 1) ? 'Z' : 'Q';
+        // matches at odd and even positions (some of them close to the end)
+        for (auto copies = random.Next(4); copies > 0; copies--)
+        {
+            const auto offset = input.size() - pattern.bytes.size() - random.Next(iteration < 32 ? static_cast<uint32>(input.size() - pattern.bytes.size()) : 64);
+            std::copy(pattern.bytes.begin(), pattern.bytes.end(), input.begin() + offset);
+        }
+        if (iteration & 1)
+            input[random.Next(static_cast<uint32>(input.size()))] = 'x';
+        REQUIRE(FindAll(searcher, input) == FindAllNaive(pattern, input));
+    }
+
+    // the same with wildcards and ignore case
+    pattern.mask[5]    = BytePattern::ANY;
+    pattern.bytes[32]  = 'X';
+    pattern.ignoreCase = true;
+    InitSearcher(searcher, pattern);
+    std::vector<uint8> input(0x8000);
+    for (size_t i = 0; i < input.size(); i++)
+        input[i] = (i & 1) ? 'z' : 'Q';
+    for (auto offset : { 0x1001U, 0x4000U, 0x7000U, 0x8000U - 33 })
+    {
+        std::copy(pattern.bytes.begin(), pattern.bytes.end(), input.begin() + offset);
+        input[offset + 32] = 'x';
+    }
+    REQUIRE(FindAll(searcher, input) == FindAllNaive(pattern, input));
+}
+
+TEST_CASE("BytePatternChunks", "[Utils]BytePattern")
+{
+    // the search of the find dialog: consecutive chunks overlap with length-1 bytes and the matches have to start at a multiple of
+    // "alignment" (2 for UTF-16) relative to the searched area
+    SplitMix64 random{ 4 };
+    for (auto iteration = 0U; iteration < 64; iteration++)
+    {
+        const auto length    = 1 + random.Next(MAX_PATTERN_LENGTH);
+        const auto pattern   = CreatePattern(random, length, (iteration & 1) != 0, (iteration & 2) != 0);
+        const auto alignment = (iteration & 4) ? 2U : 1U;
+        BytePattern searcher;
+        InitSearcher(searcher, pattern);
+
+        std::vector<uint8> content(0x3000 + random.Next(0x100));
+        for (auto& value : content)
+            value = NextByte(random);
+        Buffer buffer;
+        buffer.Resize(content.size());
+        memcpy(buffer.GetData(), content.data(), content.size());
+        DataCache cache;
+        REQUIRE(cache.Init(std::move(buffer), 0));
+
+        // a match in the overlap of two chunks is reported twice
+        std::vector<size_t> positions;
+        const auto chunkSize = 0x100 + random.Next(0x100);
+        REQUIRE(cache.ForEachChunk(
+              0,
+              cache.GetSize(),
+              chunkSize,
+              length - 1,
+              [&](uint64 chunkOffset, BufferView chunk)
+              {
+                  REQUIRE(chunkOffset % alignment == 0);
+                  size_t start    = 0;
+                  size_t position = 0;
+                  while (searcher.Find(chunk, start, position))
+                  {
+                      start = position + 1;
+                      if ((chunkOffset + position) % alignment != 0)
+                          continue;
+                      if ((positions.empty()) || (positions.back() < chunkOffset + position))
+                          positions.push_back(static_cast<size_t>(chunkOffset + position));
+                  }
+                  return true;
+              },
+              alignment));
+        REQUIRE(positions == FindAllNaive(pattern, content, alignment));
+    }
+}
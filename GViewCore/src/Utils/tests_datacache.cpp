@@ -0,0 +1,225 @@
+#include <catch.hpp>
+#include "Internal.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+using namespace GView::Utils;
+
+// deterministic values (splitmix64)
+static uint64 NextValue(uint64& state)
+{
+    uint64 z = (state += 0x9E3779B97F4A7C15ULL);
+    z        = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z        = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+static std::vector<uint8> CreateContent(size_t size, uint64 seed)
+{
+    std::vector<uint8> content(size);
+    for (auto& value : content)
+        value = static_cast<uint8>(NextValue(seed));
+    return content;
+}
+
+// a copy of the original content with the patches applied (the expected output of the cache)
+struct PatchedContent
+{
+    std::vector<uint8> patched;
+    std::vector<bool> modified;
+
+    void Patch(DataCache& cache, uint64 offset, size_t size, uint8 value)
+    {
+        std::vector<uint8> bytes(size, value);
+        REQUIRE(cache.Patch(offset, BufferView(bytes.data(), bytes.size())));
+        std::fill(patched.begin() + offset, patched.begin() + offset + size, value);
+        std::fill(modified.begin() + offset, modified.begin() + offset + size, true);
+    }
+    uint64 GetModifiedCount(size_t offset, size_t size) const
+    {
+        return std::count(modified.begin() + offset, modified.begin() + offset + size, true);
+    }
+};
+
+static std::filesystem::path CreateTestFile(const std::string& name, const std::vector<uint8>& content)
+{
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f.write(reinterpret_cast<const char*>(content.data()), content.size());
+    REQUIRE(f.good());
+    return path;
+}
+static std::vector<uint8> ReadTestFile(const std::filesystem::path& path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::vector<uint8>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+// Get, CopyToBuffer and SaveAs must all return the patched content
+static void CheckContent(DataCache& cache, const std::vector<uint8>& expected, uint64& seed)
+{
+    REQUIRE(cache.GetSize() == expected.size());
+    for (auto iteration = 0U; iteration < 256; iteration++)
+    {
+        const auto offset = NextValue(seed) % expected.size();
+        const auto size   = 1 + static_cast<uint32>(NextValue(seed) % std::min<uint64>(expected.size() - offset, cache.GetCacheSize()));
+        const auto view   = cache.Get(offset, size, true);
+        REQUIRE(view.GetLength() == size);
+        REQUIRE(std::equal(view.begin(), view.end(), expected.begin() + offset));
+    }
+    const auto copy = cache.CopyToBuffer(0, static_cast<uint32>(expected.size()));
+    REQUIRE(copy.GetLength() == expected.size());
+    REQUIRE(std::equal(copy.GetData(), copy.GetData() + copy.GetLength(), expected.begin()));
+
+    const auto path = std::filesystem::temp_directory_path() / "gview_tests_datacache_saved.bin";
+    REQUIRE(cache.SaveAs(path));
+    REQUIRE(ReadTestFile(path) == expected);
+    std::filesystem::remove(path);
+}
+
+constexpr size_t CONTENT_SIZE = 0x50000; // more than the (minimum) cache size => several windows for a file
+
+TEST_CASE("DataCachePatches", "[Utils]DataCache")
+{
+    uint64 seed        = 1;
+    const auto content = CreateContent(CONTENT_SIZE, 2);
+    const auto file    = CreateTestFile("gview_tests_datacache.bin", content);
+
+    for (auto useFile : { false, true })
+    {
+        DataCache cache;
+        if (useFile)
+        {
+            REQUIRE(cache.Init(file, 0x10000, false));
+        }
+        else
+        {
+            Buffer buffer;
+            buffer.Resize(content.size());
+            memcpy(buffer.GetData(), content.data(), content.size());
+            REQUIRE(cache.Init(std::move(buffer), 0x10000));
+        }
+        PatchedContent reference{ content, std::vector<bool>(content.size(), false) };
+        REQUIRE(cache.HasPatches() == false);
+
+        // separate, adjacent (before and after), overlapping (both margins), contained and covering intervals
+        reference.Patch(cache, 0x1000, 0x100, 0x11);
+        reference.Patch(cache, 0x1100, 0x10, 0x22);
+        reference.Patch(cache, 0xFF0, 0x10, 0x33);
+        reference.Patch(cache, 0x2000, 0x100, 0x44);
+        reference.Patch(cache, 0x1F80, 0x100, 0x55);
+        reference.Patch(cache, 0x20F0, 0x20, 0x66);
+        reference.Patch(cache, 0x2010, 0x10, 0x77);
+        reference.Patch(cache, 0x3000, 0x10, 0x88);
+        reference.Patch(cache, 0x3020, 0x10, 0x99);
+        reference.Patch(cache, 0x2FF0, 0x100, 0xAA);
+        // first and last byte, a window margin
+        reference.Patch(cache, 0, 1, 0xBB);
+        reference.Patch(cache, CONTENT_SIZE - 1, 1, 0xCC);
+        reference.Patch(cache, 0xFFF8, 0x10, 0xDD);
+        REQUIRE(cache.HasPatches());
+        REQUIRE(cache.GetPatchedSize() == reference.GetModifiedCount(0, CONTENT_SIZE));
+        CheckContent(cache, reference.patched, seed);
+
+        // random intervals (they end up merged with the previous ones)
+        for (auto iteration = 0U; iteration < 200; iteration++)
+        {
+            const auto offset = NextValue(seed) % CONTENT_SIZE;
+            const auto size   = 1 + NextValue(seed) % std::min<uint64>(CONTENT_SIZE - offset, 0x400);
+            reference.Patch(cache, offset, static_cast<size_t>(size), static_cast<uint8>(iteration));
+        }
+        REQUIRE(cache.GetPatchedSize() == reference.GetModifiedCount(0, CONTENT_SIZE));
+        CheckContent(cache, reference.patched, seed);
+
+        // the readers share the overlay
+        auto reader = cache.CreateReader(0, false);
+        CheckContent(reader, reference.patched, seed);
+
+        // out of range
+        uint8 value = 0;
+        REQUIRE(cache.Patch(CONTENT_SIZE, BufferView(&value, 1)) == false);
+        REQUIRE(cache.Patch(CONTENT_SIZE - 1, BufferView(content.data(), 2)) == false);
+
+        cache.ClearPatches();
+        REQUIRE(cache.HasPatches() == false);
+        REQUIRE(cache.GetPatchedSize() == 0);
+        CheckContent(cache, content, seed);
+    }
+    std::filesystem::remove(file);
+}
+
+TEST_CASE("DataCacheRangePatches", "[Utils]DataCache")
+{
+    uint64 seed        = 3;
+    const auto content = CreateContent(CONTENT_SIZE, 4);
+    const auto file    = CreateTestFile("gview_tests_datacache_range.bin", content);
+
+    for (auto useFile : { false, true })
+    {
+        DataCache parent;
+        if (useFile)
+        {
+            REQUIRE(parent.Init(file, 0x10000, false));
+        }
+        else
+        {
+            Buffer buffer;
+            buffer.Resize(content.size());
+            memcpy(buffer.GetData(), content.data(), content.size());
+            REQUIRE(parent.Init(std::move(buffer), 0x10000));
+        }
+        PatchedContent reference{ content, std::vector<bool>(content.size(), false) };
+        // inside the range, crossing both of its margins and outside of it
+        reference.Patch(parent, 0x18000, 0x100, 0x11);
+        reference.Patch(parent, 0x10FF0, 0x20, 0x22);
+        reference.Patch(parent, 0x30FF0, 0x20, 0x33);
+        reference.Patch(parent, 0x100, 0x100, 0x44);
+
+        // a range that is opened from a patched cache shows the patches
+        constexpr uint64 RANGE_OFFSET = 0x11000;
+        constexpr uint64 RANGE_SIZE   = 0x20000;
+        DataCache range;
+        REQUIRE(range.Init(parent, RANGE_OFFSET, RANGE_SIZE, 0x10000));
+        const auto Expected = [&]()
+        { return std::vector<uint8>(reference.patched.begin() + RANGE_OFFSET, reference.patched.begin() + RANGE_OFFSET + RANGE_SIZE); };
+        REQUIRE(range.HasPatches());
+        REQUIRE(range.GetPatchedSize() == reference.GetModifiedCount(RANGE_OFFSET, RANGE_SIZE));
+        CheckContent(range, Expected(), seed);
+
+        // changes made after the range was opened (from the parent and from the range) are visible in both
+        reference.Patch(parent, 0x20000, 0x10, 0x55);
+        std::vector<uint8> bytes(0x20, 0x66);
+        REQUIRE(range.Patch(0x100, BufferView(bytes.data(), bytes.size())));
+        std::fill(reference.patched.begin() + RANGE_OFFSET + 0x100, reference.patched.begin() + RANGE_OFFSET + 0x120, 0x66);
+        std::fill(reference.modified.begin() + RANGE_OFFSET + 0x100, reference.modified.begin() + RANGE_OFFSET + 0x120, true);
+        CheckContent(range, Expected(), seed);
+        CheckContent(parent, reference.patched, seed);
+
+        // a range of a range
+        DataCache inner;
+        REQUIRE(inner.Init(range, 0x7000, 0x2000, 0x10000));
+        CheckContent(
+              inner, std::vector<uint8>(reference.patched.begin() + RANGE_OFFSET + 0x7000, reference.patched.begin() + RANGE_OFFSET + 0x9000), seed);
+
+        // a range without patches
+        DataCache clean;
+        REQUIRE(clean.Init(parent, 0x1000, 0x1000, 0x10000));
+        REQUIRE(clean.HasPatches() == false);
+        REQUIRE(clean.GetPatchedSize() == 0);
+
+        // only the modified bytes of the range are removed
+        range.ClearPatches();
+        for (auto offset = RANGE_OFFSET; offset < RANGE_OFFSET + RANGE_SIZE; offset++)
+        {
+            reference.patched[offset]  = content[offset];
+            reference.modified[offset] = false;
+        }
+        REQUIRE(range.HasPatches() == false);
+        REQUIRE(parent.HasPatches());
+        REQUIRE(parent.GetPatchedSize() == reference.GetModifiedCount(0, CONTENT_SIZE));
+        CheckContent(range, Expected(), seed);
+        CheckContent(parent, reference.patched, seed);
+    }
+    std::filesystem::remove(file);
+}
@@ -23,6 +23,8 @@ constexpr int32 RADIOBOX_ID_TEXT_HEX              = 13;
 constexpr int32 RADIOBOX_ID_TEXT_DEC              = 14;
 constexpr int32 CHECKBOX_ID_TEXT_REGEX            = 15;
 
+constexpr uint32 MAX_REGEX_MATCH_OVERLAP = 0x400;
+
 constexpr int32 GROUPD_ID_SEARCH_TYPE    = 1;
 constexpr int32 GROUPD_ID_TEXT_TYPE      = 2;
 constexpr int32 GROUPD_ID_BUFFER_TYPE    = 3;
@@ -437,253 +439,230 @@ bool FindDialog::ProcessInput(uint64 end, bool last)
         format = "[0x%.16llX/0x%.16llX] bytes...";
     }
 
-    const auto block = (last && end != GView::Utils::INVALID_OFFSET) ? (end - currentPos) : object->GetData().GetCacheSize();
-
-    const auto SearchInAsciiChunk = [&](uint64 offset, uint64 left, const std::regex& pattern)
+    // the searched area: after the current position (up to "end" when searching backwards) or each of the selected zones
+    const auto SearchArea = [&](const auto& SearchRange)
     {
-        do
+        if (computeForFile)
         {
-            CHECK(ProgressStatus::Update(offset, ls.Format(format, offset, objectSize)) == false, false, "");
-
-            const auto sizeToRead = (left >= block ? block : left);
-            left -= (left >= block ? block : left);
-
-            const auto buffer = object->GetData().Get(offset, static_cast<uint32>(sizeToRead), true);
-            CHECK(buffer.IsValid(), false, "");
+            const auto left = (last && end != GView::Utils::INVALID_OFFSET) ? (end - currentPos) : (object->GetData().GetSize() - currentPos);
+            CHECK(SearchRange(currentPos, left), false, "");
+            return HasResults();
+        }
+        for (const auto& zone : selectedZones)
+        {
+            CHECK(SearchRange(zone.start, zone.end - zone.start + 1), false, "");
+            CHECK(HasResults() == false, true, "");
+        }
+        return false;
+    };
 
-            const auto initialStart = reinterpret_cast<char const*>(buffer.GetData());
-            auto start              = reinterpret_cast<char const*>(buffer.GetData());
-            const auto end          = reinterpret_cast<char const*>(start + buffer.GetLength());
-            std::cmatch matches{};
-            while (std::regex_search(start, end, matches, pattern))
-            {
-                match = std::pair<uint64, uint64>{ offset + (start - initialStart) + matches.position(), matches.length() };
-                start += matches.position() + matches.length();
-                CHECKBK(last, "");
-            }
+    // binary input and plain text: consecutive chunks overlap with all the bytes of the pattern but one => a match that crosses a
+    // chunk boundary is found in the next chunk. "alignment" - the matches start at a multiple of it (relative to the area).
+    // "last" => go through the entire area (the last match is needed), otherwise stop at the first match
+    const auto SearchPattern = [&](const GView::Utils::BytePattern& pattern, uint32 alignment)
+    {
+        return SearchArea(
+              [&](uint64 offset, uint64 left)
+              {
+                  const auto length    = pattern.GetLength();
+                  const auto completed = object->GetData().ForEachChunk(
+                        offset,
+                        left,
+                        0,
+                        std::min<uint32>(length - 1, object->GetData().GetCacheSize() / 2),
+                        [&](uint64 chunkOffset, BufferView buffer)
+                        {
+                            CHECK(ProgressStatus::Update(chunkOffset, ls.Format(format, chunkOffset, objectSize)) == false, false, "");
+
+                            size_t start    = 0;
+                            size_t position = 0;
+                            while (pattern.Find(buffer, start, position))
+                            {
+                                start = position + 1;
+                                if ((chunkOffset - offset + position) % alignment != 0)
+                                    continue;
+                                match = std::pair<uint64, uint64>{ chunkOffset + position, length };
+                                if (!last)
+                                    return false;
+                            }
+                            return true;
+                        },
+                        alignment);
+
+                  return completed || HasResults();
+              });
+    };
 
-            offset += sizeToRead;
-        } while (left > 0);
+    // for regular expressions only matches of up to MAX_REGEX_MATCH_OVERLAP bytes are guaranteed to be found across a chunk boundary
+    const auto overlap = std::min<uint32>(MAX_REGEX_MATCH_OVERLAP, object->GetData().GetCacheSize() / 2);
 
-        return true;
+    const auto SearchInAsciiChunk = [&](uint64 offset, uint64 left, const std::regex& pattern)
+    {
+        const auto completed = object->GetData().ForEachChunk(
+              offset,
+              left,
+              0,
+              overlap,
+              [&](uint64 chunkOffset, BufferView buffer)
+              {
+                  CHECK(ProgressStatus::Update(chunkOffset, ls.Format(format, chunkOffset, objectSize)) == false, false, "");
+
+                  const auto initialStart = reinterpret_cast<char const*>(buffer.GetData());
+                  auto start              = initialStart;
+                  const auto end          = initialStart + buffer.GetLength();
+                  std::cmatch matches{};
+                  while (std::regex_search(start, end, matches, pattern))
+                  {
+                      match = std::pair<uint64, uint64>{ chunkOffset + (start - initialStart) + matches.position(), matches.length() };
+                      start += matches.position() + std::max<std::ptrdiff_t>(matches.length(), 1);
+                      if (!last)
+                          return false;
+                  }
+                  return true;
+              });
+
+        return completed || HasResults();
     };
 
     const auto SearchInUnicodeChunk = [&](uint64 offset, uint64 left, const std::wregex& pattern)
     {
-        do
-        {
-            CHECK(ProgressStatus::Update(offset, ls.Format(format, offset, objectSize)) == false, false, "");
-
-            const auto sizeToRead = (left >= block ? block : left);
-            left -= (left >= block ? block : left);
+        const auto completed = object->GetData().ForEachChunk(
+              offset,
+              left,
+              0,
+              overlap,
+              [&](uint64 chunkOffset, BufferView buffer)
+              {
+                  CHECK(ProgressStatus::Update(chunkOffset, ls.Format(format, chunkOffset, objectSize)) == false, false, "");
+
+                  const auto initialStart = reinterpret_cast<wchar_t const*>(buffer.GetData());
+                  auto start              = initialStart;
+                  const auto end          = initialStart + buffer.GetLength() / sizeof(wchar_t);
+                  std::wcmatch matches{};
+                  while (std::regex_search(start, end, matches, pattern))
+                  {
+                      const auto position = (start - initialStart) + matches.position();
+                      match               = std::pair<uint64, uint64>{ chunkOffset + position * sizeof(wchar_t), matches.length() * sizeof(wchar_t) };
+                      start += matches.position() + std::max<std::ptrdiff_t>(matches.length(), 1);
+                      if (!last)
+                          return false;
+                  }
+                  return true;
+              },
+              sizeof(wchar_t));
+
+        return completed || HasResults();
+    };
 
-            const auto buffer = object->GetData().Get(offset, static_cast<uint32>(sizeToRead), true);
-            CHECK(buffer.IsValid(), false, "");
+    const auto regexFlags = ignoreCase->IsChecked() ? std::regex_constants::icase | std::regex_constants::ECMAScript | std::regex_constants::optimize
+                                                    : std::regex_constants::ECMAScript | std::regex_constants::optimize;
 
-            auto initialStart = reinterpret_cast<wchar_t const*>(buffer.GetData());
-            auto start        = reinterpret_cast<wchar_t const*>(buffer.GetData());
-            const auto end    = reinterpret_cast<wchar_t const*>(start + buffer.GetLength());
-            std::wcmatch matches{};
-            while (std::regex_search(start, end, matches, pattern))
+    if (textOption->IsChecked())
+    {
+        if (textRegex->IsChecked())
+        {
+            if (textAscii->IsChecked())
             {
-                match = std::pair<uint64, uint64>{ offset + (start - initialStart) * sizeof(wchar_t) + matches.position(), matches.length() };
-                start += matches.position() + matches.length();
-                CHECKBK(last, "");
-            }
+                std::string ascii;
+                usb.ToString(ascii);
 
-            offset += sizeToRead;
-        } while (left > 0);
+                const std::regex pattern(ascii, regexFlags);
+                return SearchArea([&](uint64 offset, uint64 left) { return SearchInAsciiChunk(offset, left, pattern); });
+            }
 
-        return true;
-    };
+            std::wstring unicode{ reinterpret_cast<const wchar_t*>(usb.ToStringView().data()), usb.ToStringView().size() };
+            const std::wregex pattern(unicode, regexFlags);
+            return SearchArea([&](uint64 offset, uint64 left) { return SearchInUnicodeChunk(offset, left, pattern); });
+        }
 
-    if (textOption->IsChecked())
-    {
+        // plain text => the bytes of the text (UTF-16LE for unicode - only the ASCII letters are compared ignoring the case)
+        GView::Utils::BytePattern pattern;
         if (textAscii->IsChecked())
         {
             std::string ascii;
             usb.ToString(ascii);
-
-            if (textRegex->IsChecked() == false)
-            {
-                const static std::regex specialChars{ R"([-[\]{}()*+?.,\^$|#\s])" };
-                ascii = std::regex_replace(ascii, specialChars, R"(\$&)");
-            }
-
-            const std::regex pattern(
-                  ascii,
-                  (ignoreCase->IsChecked() ? std::regex_constants::icase | std::regex_constants::ECMAScript | std::regex_constants::optimize
-                                           : std::regex_constants::ECMAScript | std::regex_constants::optimize));
-
-            if (computeForFile)
-            {
-                auto offset = currentPos;
-                auto left   = (last && end != GView::Utils::INVALID_OFFSET) ? (end - currentPos) : (object->GetData().GetSize() - currentPos);
-
-                CHECK(SearchInAsciiChunk(offset, left, pattern), false, "");
-                CHECK(HasResults() == false, true, "");
-            }
-            else
-            {
-                for (const auto& zone : selectedZones)
-                {
-                    auto offset = zone.start;
-                    auto left   = zone.end - zone.start + 1;
-
-                    CHECK(SearchInAsciiChunk(offset, left, pattern), false, "");
-                    CHECK(HasResults() == false, true, "");
-                }
-            }
+            CHECK(pattern.Init(BufferView(ascii.data(), ascii.size()), {}, ignoreCase->IsChecked()), false, "");
+            return SearchPattern(pattern, 1);
         }
-        else
-        {
-            std::wstring unicode{ reinterpret_cast<const wchar_t*>(usb.ToStringView().data()), usb.ToStringView().size() };
-
-            if (textRegex->IsChecked() == false)
-            {
-                const static std::wregex specialChars{ LR"([-[\]{}()*+?.,\^$|#\s])" };
-                unicode = std::regex_replace(unicode, specialChars, LR"(\$&)");
-            }
 
-            const std::wregex pattern(
-                  reinterpret_cast<wchar_t const* const>(usb.ToStringView().data()),
-                  (ignoreCase->IsChecked() ? std::regex_constants::icase | std::regex_constants::ECMAScript | std::regex_constants::optimize
-                                           : std::regex_constants::ECMAScript | std::regex_constants::optimize));
-
-            if (computeForFile)
-            {
-                auto offset = currentPos;
-                auto left   = (last && end != GView::Utils::INVALID_OFFSET) ? (end - currentPos) : (object->GetData().GetSize() - currentPos);
-
-                CHECK(SearchInUnicodeChunk(offset, left, pattern), false, "");
-                CHECK(HasResults() == false, true, "");
-            }
-            else
-            {
-                for (const auto& zone : selectedZones)
-                {
-                    auto offset = zone.start;
-                    auto left   = zone.end - zone.start + 1;
-
-                    CHECK(SearchInUnicodeChunk(offset, left, pattern), false, "");
-                    CHECK(HasResults() == false, true, "");
-                }
-            }
+        std::vector<uint8> bytes;
+        std::vector<uint8> mask;
+        for (const auto character : usb.ToStringView())
+        {
+            const auto letter = ((character | 0x20) >= 'a') && ((character | 0x20) <= 'z');
+            bytes.push_back(static_cast<uint8>(character & 0xFF));
+            bytes.push_back(static_cast<uint8>(character >> 8));
+            mask.push_back(letter && ignoreCase->IsChecked() ? GView::Utils::BytePattern::IGNORE_CASE : GView::Utils::BytePattern::EXACT);
+            mask.push_back(GView::Utils::BytePattern::EXACT);
         }
+        CHECK(pattern.Init(BufferView(bytes.data(), bytes.size()), BufferView(mask.data(), mask.size())), false, "");
+        return SearchPattern(pattern, sizeof(char16));
     }
-    else
-    {
-        std::string input;
-        usb.ToString(input);
 
-        std::string regexPayload;
-        regexPayload.reserve(input.size() * 2);
+    std::string input;
+    usb.ToString(input);
 
-        uint64 last    = 0;
-        uint64 current = input.find_first_of(' ', last);
-        do
+    // "?" - any byte (a wildcard)
+    std::vector<uint8> bytes;
+    std::vector<uint8> mask;
+    bytes.reserve(input.size() / 2 + 1);
+    mask.reserve(input.size() / 2 + 1);
+
+    uint64 from    = 0;
+    uint64 current = input.find_first_of(' ', from);
+    do
+    {
+        if (current == std::string::npos)
         {
-            if (current == std::string::npos)
-            {
-                current = input.size();
-            }
+            current = input.size();
+        }
 
-            std::string_view number{ input.data() + last, current - last };
+        std::string_view number{ input.data() + from, current - from };
 
-            if (textDec->IsChecked())
+        if (textDec->IsChecked())
+        {
+            if (ValidateDecimal(number) == false)
             {
-                if (ValidateDecimal(number) == false)
-                {
-                    Dialogs::MessageBox::ShowError("Error!", "Invalid input!");
-                    return false;
-                }
-
-                if (number[0] == '?')
-                {
-                    regexPayload.append("[\\x00-\\xFF]");
-                }
-                else
-                {
-                    uint8 n;
-                    const std::from_chars_result resultFrom = std::from_chars(number.data(), number.data() + number.size(), n);
-                    if (resultFrom.ec == std::errc::invalid_argument || resultFrom.ec == std::errc::result_out_of_range)
-                    {
-                        Dialogs::MessageBox::ShowError("Error!", "Invalid input - conversion failed!");
-                        return false;
-                    }
-
-                    char hex[10]                        = { 0 };
-                    const std::to_chars_result resultTo = std::to_chars(std::begin(hex), std::end(hex), n, 16);
-                    if (resultTo.ec == std::errc::invalid_argument || resultTo.ec == std::errc::result_out_of_range)
-                    {
-                        Dialogs::MessageBox::ShowError("Error!", "Invalid input - conversion failed!");
-                        return false;
-                    }
-                    regexPayload.append("\\x");
-                    if (hex[1] == 0)
-                    {
-                        regexPayload.append("0");
-                    }
-                    regexPayload.append(hex);
-                }
+                Dialogs::MessageBox::ShowError("Error!", "Invalid input!");
+                return false;
             }
-            else
+        }
+        else
+        {
+            if (number.size() > 2 || ValidateHex(number) == false)
             {
-                if (number.size() > 2)
-                {
-                    Dialogs::MessageBox::ShowError("Error!", "Invalid input!");
-                    return false;
-                }
-
-                if (ValidateHex(number) == false)
-                {
-                    Dialogs::MessageBox::ShowError("Error!", "Invalid input!");
-                    return false;
-                }
-
-                if (number[0] == '?')
-                {
-                    regexPayload.append("[\\x00-\\xFF]");
-                }
-                else
-                {
-                    regexPayload.append("\\x");
-                    if (number.size() == 1)
-                    {
-                        regexPayload.append("0");
-                    }
-                    regexPayload.append(number);
-                }
+                Dialogs::MessageBox::ShowError("Error!", "Invalid input!");
+                return false;
             }
-            last = current + 1;
-        } while ((current = input.find_first_of(' ', last)) && last < input.size());
-
-        const std::regex pattern(
-              regexPayload,
-              (ignoreCase->IsChecked() ? std::regex_constants::icase | std::regex_constants::ECMAScript | std::regex_constants::optimize
-                                       : std::regex_constants::ECMAScript | std::regex_constants::optimize));
+        }
 
-        if (computeForFile)
+        if (number[0] == '?')
         {
-            auto offset = currentPos;
-            auto left   = (last && end != GView::Utils::INVALID_OFFSET) ? (end - currentPos) : (object->GetData().GetSize() - currentPos);
-
-            CHECK(SearchInAsciiChunk(offset, left, pattern), false, "");
-            CHECK(HasResults() == false, true, "");
+            bytes.push_back(0);
+            mask.push_back(GView::Utils::BytePattern::ANY);
         }
         else
         {
-            for (const auto& zone : selectedZones)
+            uint8 n;
+            const std::from_chars_result result = std::from_chars(number.data(), number.data() + number.size(), n, textDec->IsChecked() ? 10 : 16);
+            if (result.ec == std::errc::invalid_argument || result.ec == std::errc::result_out_of_range)
             {
-                auto offset = zone.start;
-                auto left   = zone.end - zone.start + 1;
-
-                CHECK(SearchInAsciiChunk(offset, left, pattern), false, "");
-                CHECK(HasResults() == false, true, "");
+                Dialogs::MessageBox::ShowError("Error!", "Invalid input - conversion failed!");
+                return false;
             }
+            bytes.push_back(n);
+            mask.push_back(GView::Utils::BytePattern::EXACT);
         }
+        from = current + 1;
+    } while ((current = input.find_first_of(' ', from)) && from < input.size());
+
+    GView::Utils::BytePattern pattern;
+    if (pattern.Init(BufferView(bytes.data(), bytes.size()), BufferView(mask.data(), mask.size()), ignoreCase->IsChecked()) == false)
+    {
+        Dialogs::MessageBox::ShowError("Error!", "Invalid input - at least one byte must not be a wildcard!");
+        return false;
     }
 
-    return false;
+    return SearchPattern(pattern, 1);
 }
 } // namespace GView::View::BufferViewer
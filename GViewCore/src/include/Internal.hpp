@@ -2,6 +2,7 @@
 
 #include "GView.hpp"
 
+#include <bitset>
 #include <set>
 #include <span>
 
@@ -124,6 +125,12 @@ namespace Utils
         }
     };
 
+    namespace FileMapping
+    {
+        // maps the entire file (read-only) in the address space; the view is released when the last reference is dropped
+        std::shared_ptr<const uint8> Map(const std::filesystem::path& path, uint64& size);
+    } // namespace FileMapping
+
     namespace CharacterEncoding
     {
         enum class Encoding : uint8
@@ -289,8 +296,11 @@ namespace Type
 
     namespace Matcher
     {
+        // text view (UTF-16) of a buffer - it is only built when a text matcher needs it (binary content is not converted)
         class TextParser
         {
+            AppCUI::Utils::BufferView buf;
+            Utils::UnicodeString unicode;
             struct
             {
                 const char16* text;
@@ -300,6 +310,7 @@ namespace Type
             {
                 const char16* text;
                 uint32 size;
+                bool computed;
             } Text;
             struct
             {
@@ -307,12 +318,19 @@ namespace Type
                 uint32 count;
                 bool computed;
             } Lines;
+            void ComputeText();
             void ComputeLineOffsets();
 
           public:
-            TextParser(const char16* text, uint32 size);
-            inline std::u16string_view GetText() const
+            TextParser(AppCUI::Utils::BufferView buf);
+            ~TextParser();
+            TextParser(const TextParser&)            = delete;
+            TextParser& operator=(const TextParser&) = delete;
+
+            inline std::u16string_view GetText()
             {
+                if (!Text.computed)
+                    ComputeText();
                 return { Text.text, static_cast<size_t>(Text.size) };
             }
             inline std::span<uint32> GetLines()
@@ -326,6 +344,11 @@ namespace Type
         {
             virtual bool Init(std::string_view text)                            = 0;
             virtual bool Match(AppCUI::Utils::BufferView buf, TextParser& text) = 0;
+            // the value of the first byte of the buffers that can be matched (false if it can be any value)
+            virtual bool GetFirstByte(uint8& /* value */) const
+            {
+                return false;
+            }
         };
         class MagicMatcher : public Interface
         {
@@ -344,6 +367,7 @@ namespace Type
             }
             virtual bool Init(std::string_view text) override;
             virtual bool Match(AppCUI::Utils::BufferView buf, TextParser& text) override;
+            virtual bool GetFirstByte(uint8& value) const override;
         };
         class StartsWithMatcher : public Interface
         {
@@ -386,6 +410,7 @@ namespace Type
         bool (*fnValidate)(const AppCUI::Utils::BufferView& buf, const std::string_view& extension);
         TypeInterface* (*fnCreateInstance)();
         bool (*fnPopulateWindow)(Reference<GView::View::WindowInterface> win);
+        bool (*fnAnalyze)(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output); // optional
 
         bool LoadPlugin();
 
@@ -395,9 +420,17 @@ namespace Type
         void Init();
         bool MatchExtension(uint64 extensionHash);
         bool MatchContent(AppCUI::Utils::BufferView buf, Matcher::TextParser& textParser);
+        void GetExtensions(std::vector<uint64>& hashes) const;
+        bool GetContentFirstBytes(std::bitset<256>& bytes) const;
+        bool Load(); // loads the plugin library (if not already loaded)
         bool IsOfType(AppCUI::Utils::BufferView buf, GView::Type::Matcher::TextParser& textParser, const std::string_view& extension = "");
         bool PopulateWindow(Reference<GView::View::WindowInterface> win) const;
+        bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output) const;
         TypeInterface* CreateInstance() const;
+        inline bool HasAnalyze() const
+        {
+            return this->fnAnalyze != nullptr;
+        }
         inline bool operator<(const Plugin& plugin) const
         {
             return priority > plugin.priority;
@@ -418,6 +451,20 @@ namespace Type
         static uint64 ExtensionToHash(std::string_view ext);
         static uint64 ExtensionToHash(std::u16string_view ext);
     };
+
+    // plugins (indexes in the sorted list of type plugins) that can match an extension or the first byte of a buffer
+    // built once, after all plugins are loaded, so that only those candidates are checked when a file is opened
+    class PluginsIndex
+    {
+        std::unordered_map<uint64, std::vector<uint32>> byExtension;
+        std::vector<uint32> byFirstByte[256]; // plugins with a magic for that byte + plugins whose patterns are not magics
+        std::vector<uint32> anyFirstByte;     // plugins whose patterns are not magics (used for empty buffers)
+
+      public:
+        void Build(const std::vector<Plugin>& plugins);
+        std::span<const uint32> GetExtensionCandidates(uint64 extensionHash) const;
+        std::span<const uint32> GetContentCandidates(AppCUI::Utils::BufferView buf) const;
+    };
 } // namespace Type
 
 namespace App
@@ -475,14 +522,19 @@ namespace App
         AppCUI::Controls::Menu* mnuHelp;
         AppCUI::Controls::Menu* mnuFile;
         std::vector<GView::Type::Plugin> typePlugins;
+        GView::Type::PluginsIndex typePluginsIndex;
         std::vector<GView::Generic::Plugin> genericPlugins;
         GView::Type::Plugin defaultPlugin;
         GView::Utils::ErrorList errList;
         uint32 defaultCacheSize;
+        uint32 cachePageSize;
+        bool useMemoryMapping;
+        bool useReadAhead;
         std::filesystem::path lastOpenedFolderLocation;
 
         bool BuildMainMenus();
         bool LoadSettings();
+        bool LoadSettings(AppCUI::Utils::IniObject& ini);
         void OpenFile();
         void OpenFolder();
         void ShowErrors();
@@ -529,7 +581,7 @@ namespace App
               std::u16string& newName);
         bool Add(
               GView::Object::Type objType,
-              std::unique_ptr<AppCUI::OS::DataObject> data,
+              GView::Utils::DataCache&& cache,
               const AppCUI::Utils::ConstString& name,
               const AppCUI::Utils::ConstString& path,
               uint32 PID,
@@ -542,8 +594,21 @@ namespace App
         Instance();
         virtual ~Instance() {}
         bool Init();
+        bool InitHeadless();
+        Reference<Type::Plugin> IdentifyFile(const std::filesystem::path& path);
+        bool AnalyzeFile(const std::filesystem::path& path, GView::Utils::JSONWriter& output);
         bool AddFileWindow(const std::filesystem::path& path, OpenMethod method, string_view typeName, Reference<Window> parent = nullptr);
         bool AddBufferWindow(BufferView buf, const ConstString& name, const ConstString& path, OpenMethod method, string_view typeName, Reference<Window> parent);
+        bool AddBufferWindow(Buffer&& buf, const ConstString& name, const ConstString& path, OpenMethod method, string_view typeName, Reference<Window> parent);
+        bool AddRangeWindow(
+              Reference<GView::Object> object,
+              uint64 offset,
+              uint64 size,
+              const ConstString& name,
+              const ConstString& path,
+              OpenMethod method,
+              string_view typeName,
+              Reference<Window> parent);
         void UpdateCommandBar(AppCUI::Application::CommandBar& commandBar);
 
         // inline getters
@@ -624,8 +689,10 @@ namespace App
 
     class FileWindowProperties : public Window
     {
+        Reference<GView::Object> obj;
+
       public:
-        FileWindowProperties(Reference<Tab> viewContainer);
+        FileWindowProperties(Reference<Tab> viewContainer, Reference<GView::Object> obj);
         bool OnEvent(Reference<Control>, Event eventType, int) override;
     };
 
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "GView.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace GView::GenericPlugins::EntropyVisualizer
+{
+// blocks up to this size are computed from the counters updated byte by byte (no histogram to clear and sum for each block)
+static const uint32 SMALL_BLOCK_MAX_SIZE = 256;
+// bytes processed by a worker for one task - the map is drawn one task at a time
+static const uint32 ENTROPY_TASK_SIZE = 0x100000;
+
+using BlockHistogram = std::array<uint32, 256>;
+
+// value computed for each block
+enum class BlockMeasure : uint8 {
+  Shannon,
+  Renyi,
+  RegionType // GView::Entropy::RegionType of the block
+};
+
+// Entropy of each block of an object, computed by a pool of workers (each one with its own reader). Tasks (consecutive blocks)
+// that are done are kept when the workers are stopped => a new Start() computes only the remaining ones.
+class EntropyMap
+{
+    Reference<Object> object;
+    uint32 blockSize;
+    BlockMeasure measure;
+    double alpha;
+    uint64 blocksCount;
+    uint64 blocksPerTask;
+    std::vector<float> values;
+    std::vector<BlockHistogram> histograms; // kept only if requested (the base of an entropy pyramid)
+
+    std::mutex lock;
+    std::condition_variable changed;
+    std::vector<bool> done;       // tasks
+    std::vector<uint64> pending;  // tasks given to the workers by the last Start()
+    std::vector<uint64> finished; // tasks done since the last GetFinishedTasks()
+    uint64 completedBlocks{ 0 };
+    uint32 runningWorkers{ 0 };
+
+    std::atomic<uint64> nextTask{ 0 };
+    std::atomic<bool> stop{ false };
+    std::vector<std::thread> workers;
+
+    void Run(GView::Utils::DataCache reader);
+    bool ComputeTask(GView::Utils::DataCache& reader, uint64 task, GView::Entropy::RegionClassifier* classifier);
+    void SetBlock(uint64 block, const GView::Entropy::Histogram& histogram);
+
+  public:
+    EntropyMap(Reference<Object> object, uint32 blockSize, BlockMeasure measure, double alpha, bool keepHistograms = false);
+    ~EntropyMap();
+
+    inline bool Matches(uint32 _blockSize, BlockMeasure _measure, double _alpha) const
+    {
+        return (blockSize == _blockSize) && (measure == _measure) && (measure != BlockMeasure::Renyi || alpha == _alpha);
+    }
+    inline uint64 GetBlocksCount() const
+    {
+        return blocksCount;
+    }
+    inline uint64 GetTaskFirstBlock(uint64 task) const
+    {
+        return task * blocksPerTask;
+    }
+    inline uint64 GetTaskBlocksCount(uint64 task) const
+    {
+        return std::min<uint64>(blocksPerTask, blocksCount - task * blocksPerTask);
+    }
+    // valid for the blocks of a task returned by GetFinishedTasks()
+    inline double GetValue(uint64 block) const
+    {
+        return values[block];
+    }
+    inline const BlockHistogram& GetHistogram(uint64 block) const
+    {
+        return histograms[block];
+    }
+    inline std::vector<BlockHistogram> TakeHistograms()
+    {
+        return std::move(histograms);
+    }
+
+    void Start();
+    void Stop();
+    bool IsComplete();
+    uint64 GetCompletedBlocks();
+    bool AreBlocksDone(uint64 first, uint64 count);
+    // tasks done since the last call (or all of them) - their values can be read
+    void GetFinishedTasks(std::vector<uint64>& tasks, bool all);
+    // false if there is nothing to wait for (complete or stopped)
+    bool WaitForTasks(uint32 milliseconds);
+};
+} // namespace GView::GenericPlugins::EntropyVisualizer
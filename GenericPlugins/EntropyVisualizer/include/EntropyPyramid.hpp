@@ -0,0 +1,45 @@
+#pragma once
+
+#include "EntropyMap.hpp"
+
+#include <filesystem>
+
+namespace GView::GenericPlugins::EntropyVisualizer
+{
+static const uint32 PYRAMID_MIN_BASE_BLOCK_SIZE = 0x1000;
+static const uint64 PYRAMID_MAX_BASE_BLOCKS     = 0x2000; // 8K histograms (8 MB) for the base level, whatever the size of the object
+
+// Byte histograms of the blocks of an object (the base level) merged bottom-up: levels[k] has the histograms of the blocks of
+// baseBlockSize * 2^k bytes. The entropy for any multiple of the base block size is computed from the histograms (no I/O).
+// For files, the base level is saved next to the file (<file>.entropy.cache) and used while the file is not changed.
+class EntropyPyramid
+{
+    uint32 baseBlockSize{ 0 };
+    uint64 size{ 0 };
+    std::vector<std::vector<BlockHistogram>> levels;
+
+    static std::filesystem::path GetCacheFilePath(Reference<Object> object);
+    static bool GetFileIdentity(const std::filesystem::path& path, uint64& fileSize, int64& modified);
+
+  public:
+    // power of two => the blocks drawn for the initial block size (and any power of two larger than this) are in the pyramid
+    static uint32 GetBaseBlockSize(uint64 size);
+
+    inline bool IsReady() const
+    {
+        return !levels.empty();
+    }
+    inline bool CanCompute(uint32 blockSize) const
+    {
+        return IsReady() && (blockSize % baseBlockSize == 0);
+    }
+
+    void Build(uint64 size, uint32 baseBlockSize, std::vector<BlockHistogram>&& base);
+    // sum of the histograms of the base blocks [first, first + count)
+    void GetHistogram(uint64 first, uint64 count, GView::Entropy::Histogram& histogram) const;
+    void GetValues(uint32 blockSize, bool renyi, double alpha, std::vector<float>& values) const;
+
+    bool Load(Reference<Object> object);
+    bool Save(Reference<Object> object) const;
+};
+} // namespace GView::GenericPlugins::EntropyVisualizer
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "GView.hpp"
+#include "EntropyMap.hpp"
+#include "EntropyPyramid.hpp"
+
+#include <memory>
 
 namespace GView::GenericPlugins::EntropyVisualizer
 {
@@ -16,17 +20,25 @@ static const std::string_view SHANNON_ENTROPY_DATA_TYPE_OPTION_NAME = "Shannon E
 static const uint32 EMBEDDED_OBJECTS_MAX_VALUE                      = 6;
 static const uint32 EMBEDDED_OBJECTS_LEGEND_HEIGHT                  = 12 + 8;
 static const std::string_view EMBEDDED_OBJECTS_OPTION_NAME          = "Embedded Objects";
+static const uint32 REGION_TYPES_MAX_VALUE                          = static_cast<uint32>(GView::Entropy::RegionType::Data);
+static const uint32 REGION_TYPES_LEGEND_HEIGHT                      = 16;
+static const std::string_view REGION_TYPES_OPTION_NAME              = "Region Types";
 static const uint32 MINIMUM_BLOCK_SIZE                              = 4;
+static const uint32 MAX_ENTROPY_MAPS                                = 4;   // computed maps kept (block size / entropy type changes)
+static const uint32 ENTROPY_PROGRESS_INTERVAL                       = 100; // milliseconds between two updates of the drawn map
+static const std::string_view CACHE_ENABLED                         = "Cache";
 
 static const uint32 COMBO_BOX_ITEM_SHANNON_ENTROPY           = 0;
 static const uint32 COMBO_BOX_ITEM_RENYI_ENTROPY             = 1;
 static const uint32 COMBO_BOX_ITEM_SHANNON_ENTROPY_DATA_TYPE = 2;
 static const uint32 COMBO_BOX_ITEM_EMBEDDED_OBJECTS          = 3;
+static const uint32 COMBO_BOX_ITEM_REGION_TYPES              = 4;
 
 enum class EntropyType {
   Shannon = 0,
   ShannonDataType = 1,
-  Renyi = 2
+  Renyi = 2,
+  RegionType = 3
 };
 
 class Plugin : public Window
@@ -46,6 +58,11 @@ class Plugin : public Window
     uint32 blockSize  = MINIMUM_BLOCK_SIZE;
     double renyiAlpha = 0.5;
 
+    std::vector<std::unique_ptr<EntropyMap>> entropyMaps; // most recently used first
+    EntropyPyramid pyramid;
+    std::unique_ptr<EntropyMap> pyramidBase; // histograms of the base blocks of the pyramid (kept if the computation is canceled)
+    bool cacheEnabled = true;
+
   private:
     void ResizeLegendCanvas();
     static Color ShannonEntropyValueToColor(int32 value);
@@ -53,7 +70,11 @@ class Plugin : public Window
     static Color ShannonEntropyDataTypeValueToColorName(std::string_view name);
     static double ComputeEpsilon(uint64 size);
     static Color EmbeddedObjectValueToColor(std::string_view name);
+    static Color RegionTypeToColor(GView::Entropy::RegionType type);
     bool InitializeBlocksForCanvas();
+    EntropyMap& GetEntropyMap(EntropyType type);
+    void DrawEntropyValue(uint64 block, double value, EntropyType type, double epsilon);
+    bool DrawEntropyFromPyramidBase(EntropyType type, double epsilon);
 
   public:
     Plugin(Reference<Object> object);
@@ -0,0 +1,263 @@
+#include "EntropyMap.hpp"
+
+#include <math.h>
+
+namespace GView::GenericPlugins::EntropyVisualizer
+{
+// Shannon: H = log2(n) - sum(c * log2(c)) / n
+// Renyi:   H = (log2(sum(c^alpha)) - alpha * log2(n)) / (1 - alpha)   (sum(p^alpha) = sum(c^alpha) / n^alpha)
+static double EntropyFromSum(bool renyi, double alpha, double sum, double log2Length, double length)
+{
+    if (!renyi || alpha == 1.0) {
+        return std::max(log2Length - sum / length, 0.0);
+    }
+    return (log2(sum) - alpha * log2Length) / (1.0 - alpha);
+}
+
+/*
+    For small blocks clearing and summing the 256 counters of a histogram costs more than counting the bytes. The sum is updated
+    with each byte instead (f(c + 1) - f(c) from a table with all the counts possible in a block) and only the counters of the
+    bytes of the block are reset => O(1) for each byte, nothing for each block.
+*/
+class SmallBlocksEntropy
+{
+    std::array<uint32, 256> counts{};
+    std::vector<double> table; // f(c) - c * log2(c) (Shannon) or c^alpha (Renyi)
+    bool renyi;
+    double alpha;
+    uint32 blockSize;
+    double log2BlockSize;
+
+  public:
+    SmallBlocksEntropy(uint32 blockSize, bool renyi, double alpha)
+        : table(blockSize + 1, 0.0), renyi(renyi), alpha(alpha), blockSize(blockSize), log2BlockSize(log2(static_cast<double>(blockSize)))
+    {
+        for (uint32 c = 1; c <= blockSize; c++) {
+            table[c] = (renyi && alpha != 1.0) ? pow(static_cast<double>(c), alpha) : c * log2(static_cast<double>(c));
+        }
+    }
+    double Compute(BufferView block)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < block.GetLength(); i++) {
+            auto& count = counts[block[i]];
+            sum += table[count + 1] - table[count];
+            count++;
+        }
+        for (size_t i = 0; i < block.GetLength(); i++) {
+            counts[block[i]] = 0;
+        }
+        // all the blocks except the last one have the same size
+        const auto length = static_cast<double>(block.GetLength());
+        return EntropyFromSum(renyi, alpha, sum, block.GetLength() == blockSize ? log2BlockSize : log2(length), length);
+    }
+};
+
+EntropyMap::EntropyMap(Reference<Object> object, uint32 blockSize, BlockMeasure measure, double alpha, bool keepHistograms)
+    : object(object), blockSize(blockSize), measure(measure), alpha(alpha)
+{
+    const auto size = object->GetData().GetSize();
+    blocksCount     = (size + blockSize - 1) / blockSize;
+    blocksPerTask   = std::max<uint64>(ENTROPY_TASK_SIZE / blockSize, 1);
+    values.resize(blocksCount);
+    if (keepHistograms) {
+        histograms.resize(blocksCount);
+    }
+    done.resize((blocksCount + blocksPerTask - 1) / blocksPerTask);
+}
+
+EntropyMap::~EntropyMap()
+{
+    Stop();
+}
+
+void EntropyMap::SetBlock(uint64 block, const GView::Entropy::Histogram& histogram)
+{
+    if (!histograms.empty()) {
+        std::copy(histogram.begin(), histogram.end(), histograms[block].begin()); // at most blockSize occurrences
+    }
+    const auto value = measure == BlockMeasure::Renyi ? GView::Entropy::RenyiEntropy(histogram, alpha) : GView::Entropy::ShannonEntropy(histogram);
+    values[block]    = static_cast<float>(value);
+}
+
+bool EntropyMap::ComputeTask(GView::Utils::DataCache& reader, uint64 task, GView::Entropy::RegionClassifier* classifier)
+{
+    const auto size  = reader.GetSize();
+    const auto first = GetTaskFirstBlock(task);
+    const auto start = first * blockSize;
+    const auto end   = std::min<uint64>((first + GetTaskBlocksCount(task)) * blockSize, size);
+
+    if (blockSize <= reader.GetCacheSize()) {
+        // the chunks are multiples of the block size => a block is never split
+        std::optional<SmallBlocksEntropy> small;
+        if ((blockSize <= SMALL_BLOCK_MAX_SIZE) && histograms.empty() && (classifier == nullptr)) {
+            small.emplace(blockSize, measure == BlockMeasure::Renyi, alpha);
+        }
+        return reader.ForEachChunk(
+              start,
+              end - start,
+              0,
+              0,
+              [&](uint64 offset, BufferView chunk) {
+                  for (size_t pos = 0; pos < chunk.GetLength(); pos += blockSize) {
+                      if (stop.load(std::memory_order_relaxed)) {
+                          return false;
+                      }
+                      const auto block = BufferView(chunk.GetData() + pos, std::min<size_t>(blockSize, chunk.GetLength() - pos));
+                      const auto index = (offset + pos) / blockSize;
+                      if (classifier != nullptr) {
+                          classifier->Reset();
+                          classifier->Update(block);
+                          values[index] = static_cast<float>(classifier->GetRegionType());
+                      } else if (small.has_value()) {
+                          values[index] = static_cast<float>(small->Compute(block));
+                      } else {
+                          GView::Entropy::Histogram histogram{};
+                          GView::Entropy::UpdateHistogram(block, histogram);
+                          SetBlock(index, histogram);
+                      }
+                  }
+                  return true;
+              },
+              blockSize);
+    }
+
+    // larger than the cache of the reader => the histogram (or the region statistics) of a block is updated with each chunk
+    for (auto offset = start; offset < end; offset += blockSize) {
+        GView::Entropy::Histogram histogram{};
+        if (classifier != nullptr) {
+            classifier->Reset();
+        }
+        const auto read = reader.ForEachChunk(offset, blockSize, 0, 0, [&](uint64, BufferView chunk) {
+            if (classifier != nullptr) {
+                classifier->Update(chunk);
+            } else {
+                GView::Entropy::UpdateHistogram(chunk, histogram);
+            }
+            return !stop.load(std::memory_order_relaxed);
+        });
+        if (!read) {
+            return false;
+        }
+        if (classifier != nullptr) {
+            values[offset / blockSize] = static_cast<float>(classifier->GetRegionType());
+        } else {
+            SetBlock(offset / blockSize, histogram);
+        }
+    }
+    return true;
+}
+
+void EntropyMap::Run(GView::Utils::DataCache reader)
+{
+    // the statistics of a region are not computed from the histogram => one classifier for all the blocks of the worker
+    std::optional<GView::Entropy::RegionClassifier> classifier;
+    if (measure == BlockMeasure::RegionType) {
+        classifier.emplace();
+    }
+    while (!stop.load(std::memory_order_relaxed)) {
+        const auto index = nextTask.fetch_add(1);
+        if (index >= pending.size()) {
+            break;
+        }
+        const auto task = pending[index];
+        if (!ComputeTask(reader, task, classifier.has_value() ? &classifier.value() : nullptr)) {
+            break; // stopped or the data can not be read
+        }
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            done[task] = true;
+            finished.push_back(task);
+            completedBlocks += GetTaskBlocksCount(task);
+        }
+        changed.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        runningWorkers--;
+    }
+    changed.notify_all();
+}
+
+void EntropyMap::Start()
+{
+    Stop(); // workers from a previous start (finished or not)
+    uint32 workersCount = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        pending.clear();
+        for (uint64 task = 0; task < done.size(); task++) {
+            if (!done[task]) {
+                pending.push_back(task);
+            }
+        }
+        if (pending.empty()) {
+            return;
+        }
+        workersCount   = static_cast<uint32>(std::min<uint64>(std::max(std::thread::hardware_concurrency(), 1U), pending.size()));
+        runningWorkers = workersCount;
+    }
+    nextTask.store(0);
+    stop.store(false);
+    for (uint32 i = 0; i < workersCount; i++) {
+        // each worker has its own cursor and pages (the views returned by a DataCache are valid only until its next read). A task
+        // fits in the cache of the reader and the workers take interleaved tasks => no read-ahead (it would read the tasks of others)
+        workers.emplace_back(&EntropyMap::Run, this, object->GetData().CreateReader(ENTROPY_TASK_SIZE, false));
+    }
+}
+
+void EntropyMap::Stop()
+{
+    stop.store(true);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+bool EntropyMap::IsComplete()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return completedBlocks == blocksCount;
+}
+
+uint64 EntropyMap::GetCompletedBlocks()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return completedBlocks;
+}
+
+bool EntropyMap::AreBlocksDone(uint64 first, uint64 count)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto task = first / blocksPerTask; task * blocksPerTask < first + count; task++) {
+        if (!done[task]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EntropyMap::GetFinishedTasks(std::vector<uint64>& tasks, bool all)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    tasks.clear();
+    if (all) {
+        for (uint64 task = 0; task < done.size(); task++) {
+            if (done[task]) {
+                tasks.push_back(task);
+            }
+        }
+    } else {
+        tasks.swap(finished);
+    }
+    finished.clear();
+}
+
+bool EntropyMap::WaitForTasks(uint32 milliseconds)
+{
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait_for(guard, std::chrono::milliseconds(milliseconds), [this]() { return !finished.empty() || runningWorkers == 0; });
+    return !finished.empty() || runningWorkers > 0;
+}
+} // namespace GView::GenericPlugins::EntropyVisualizer
@@ -0,0 +1,182 @@
+#include "EntropyPyramid.hpp"
+
+#include <fstream>
+
+namespace GView::GenericPlugins::EntropyVisualizer
+{
+constexpr char PYRAMID_MAGIC[8]     = { 'G', 'V', 'E', 'N', 'T', 'P', 'Y', 'R' };
+constexpr uint32 PYRAMID_VERSION    = 1;
+constexpr uint64 MAX_COUNTER_VALUE  = 0xFFFFFFFF;
+constexpr uint32 SMALL_COUNTER_SIZE = 0x8000; // base blocks up to this size are saved with 16 bit counters
+
+uint32 EntropyPyramid::GetBaseBlockSize(uint64 size)
+{
+    uint64 blockSize = PYRAMID_MIN_BASE_BLOCK_SIZE;
+    while (blockSize * PYRAMID_MAX_BASE_BLOCKS < size) {
+        blockSize *= 2;
+    }
+    return static_cast<uint32>(std::min<uint64>(blockSize, 0x80000000));
+}
+
+void EntropyPyramid::Build(uint64 _size, uint32 _baseBlockSize, std::vector<BlockHistogram>&& base)
+{
+    size          = _size;
+    baseBlockSize = _baseBlockSize;
+    levels.clear();
+    levels.push_back(std::move(base));
+
+    // the counters of a block are at most its size
+    auto blockSize = static_cast<uint64>(baseBlockSize);
+    while ((levels.back().size() > 1) && (blockSize * 2 <= MAX_COUNTER_VALUE)) {
+        const auto& children = levels.back();
+        std::vector<BlockHistogram> nodes((children.size() + 1) / 2);
+        for (size_t index = 0; index < nodes.size(); index++) {
+            nodes[index] = children[index * 2];
+            if (index * 2 + 1 < children.size()) {
+                const auto& right = children[index * 2 + 1];
+                for (uint32 value = 0; value < 256; value++) {
+                    nodes[index][value] += right[value];
+                }
+            }
+        }
+        levels.push_back(std::move(nodes));
+        blockSize *= 2;
+    }
+}
+
+void EntropyPyramid::GetHistogram(uint64 first, uint64 count, GView::Entropy::Histogram& histogram) const
+{
+    histogram.fill(0);
+    const auto last = std::min<uint64>(first + count, levels[0].size());
+    // the largest nodes that fit (a node of level k starts at a multiple of 2^k) => O(log(count)) histograms
+    for (auto block = first; block < last;) {
+        size_t level = 0;
+        while ((level + 1 < levels.size()) && ((block & ((2ULL << level) - 1)) == 0) && (block + (2ULL << level) <= last)) {
+            level++;
+        }
+        const auto& node = levels[level][block >> level];
+        for (uint32 value = 0; value < 256; value++) {
+            histogram[value] += node[value];
+        }
+        block += 1ULL << level;
+    }
+}
+
+void EntropyPyramid::GetValues(uint32 blockSize, bool renyi, double alpha, std::vector<float>& values) const
+{
+    const auto baseBlocks = blockSize / baseBlockSize;
+    values.resize((size + blockSize - 1) / blockSize);
+
+    GView::Entropy::Histogram histogram;
+    for (uint64 block = 0; block < values.size(); block++) {
+        GetHistogram(block * baseBlocks, baseBlocks, histogram);
+        const auto value = renyi ? GView::Entropy::RenyiEntropy(histogram, alpha) : GView::Entropy::ShannonEntropy(histogram);
+        values[block]    = static_cast<float>(value);
+    }
+}
+
+std::filesystem::path EntropyPyramid::GetCacheFilePath(Reference<Object> object)
+{
+    std::filesystem::path path = object->GetPath();
+    path += ".entropy.cache";
+    return path;
+}
+
+bool EntropyPyramid::GetFileIdentity(const std::filesystem::path& path, uint64& fileSize, int64& modified)
+{
+    std::error_code ec;
+    fileSize = std::filesystem::file_size(path, ec);
+    CHECK(!ec, false, "Fail to get the size of: %s", path.u8string().c_str());
+    modified = static_cast<int64>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+    CHECK(!ec, false, "Fail to get the last write time of: %s", path.u8string().c_str());
+    return true;
+}
+
+bool EntropyPyramid::Load(Reference<Object> object)
+{
+    CHECK(object->GetObjectType() == GView::Object::Type::File, false, "");
+    CHECK(object->GetData().HasPatches() == false, false, ""); // the content is not the one from the disk
+
+    uint64 fileSize;
+    int64 modified;
+    CHECK(GetFileIdentity(std::filesystem::path(object->GetPath()), fileSize, modified), false, "");
+    CHECK(fileSize == object->GetData().GetSize(), false, "");
+
+    const auto cachePath = GetCacheFilePath(object);
+    std::ifstream file(cachePath, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        return false; // not computed yet
+    }
+
+    // any difference means that the histograms are from another version of the file
+    char magic[sizeof(PYRAMID_MAGIC)];
+    uint32 version = 0, savedBaseBlockSize = 0;
+    uint64 savedSize = 0, blocksCount = 0;
+    int64 savedModified = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&savedSize), sizeof(savedSize));
+    file.read(reinterpret_cast<char*>(&savedModified), sizeof(savedModified));
+    file.read(reinterpret_cast<char*>(&savedBaseBlockSize), sizeof(savedBaseBlockSize));
+    file.read(reinterpret_cast<char*>(&blocksCount), sizeof(blocksCount));
+    CHECK(file.good() && (memcmp(magic, PYRAMID_MAGIC, sizeof(magic)) == 0) && (version == PYRAMID_VERSION),
+          false,
+          "Invalid entropy cache: %s",
+          cachePath.u8string().c_str());
+    CHECK((savedSize == fileSize) && (savedModified == modified), false, "");
+    CHECK(savedBaseBlockSize == GetBaseBlockSize(fileSize), false, "");
+    CHECK(blocksCount == (fileSize + savedBaseBlockSize - 1) / savedBaseBlockSize, false, "Invalid entropy cache: %s", cachePath.u8string().c_str());
+
+    std::vector<BlockHistogram> base(blocksCount);
+    if (savedBaseBlockSize <= SMALL_COUNTER_SIZE) {
+        std::array<uint16, 256> counters;
+        for (auto& histogram : base) {
+            file.read(reinterpret_cast<char*>(counters.data()), sizeof(counters));
+            std::copy(counters.begin(), counters.end(), histogram.begin());
+        }
+    } else {
+        file.read(reinterpret_cast<char*>(base.data()), static_cast<std::streamsize>(base.size() * sizeof(BlockHistogram)));
+    }
+    CHECK(file.good(), false, "Invalid entropy cache: %s", cachePath.u8string().c_str());
+
+    Build(fileSize, savedBaseBlockSize, std::move(base));
+    return true;
+}
+
+bool EntropyPyramid::Save(Reference<Object> object) const
+{
+    CHECK(IsReady(), false, "");
+    CHECK(object->GetObjectType() == GView::Object::Type::File, false, "");
+    CHECK(object->GetData().HasPatches() == false, false, "");
+
+    // the file might have changed while it was read => the histograms would be saved for the new version
+    uint64 fileSize;
+    int64 modified;
+    CHECK(GetFileIdentity(std::filesystem::path(object->GetPath()), fileSize, modified), false, "");
+    CHECK(fileSize == size, false, "The file changed while it was read: %s", std::filesystem::path(object->GetPath()).u8string().c_str());
+
+    const auto cachePath = GetCacheFilePath(object);
+    std::ofstream file(cachePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    CHECK(file.is_open(), false, "Fail to create: %s", cachePath.u8string().c_str());
+
+    const auto blocksCount = static_cast<uint64>(levels[0].size());
+    file.write(PYRAMID_MAGIC, sizeof(PYRAMID_MAGIC));
+    file.write(reinterpret_cast<const char*>(&PYRAMID_VERSION), sizeof(PYRAMID_VERSION));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(&modified), sizeof(modified));
+    file.write(reinterpret_cast<const char*>(&baseBlockSize), sizeof(baseBlockSize));
+    file.write(reinterpret_cast<const char*>(&blocksCount), sizeof(blocksCount));
+    if (baseBlockSize <= SMALL_COUNTER_SIZE) {
+        std::array<uint16, 256> counters;
+        for (const auto& histogram : levels[0]) {
+            std::copy(histogram.begin(), histogram.end(), counters.begin());
+            file.write(reinterpret_cast<const char*>(counters.data()), sizeof(counters));
+        }
+    } else {
+        file.write(reinterpret_cast<const char*>(levels[0].data()), static_cast<std::streamsize>(levels[0].size() * sizeof(BlockHistogram)));
+    }
+    file.close();
+    CHECK(file.good(), false, "Fail to write: %s", cachePath.u8string().c_str());
+    return true;
+}
+} // namespace GView::GenericPlugins::EntropyVisualizer
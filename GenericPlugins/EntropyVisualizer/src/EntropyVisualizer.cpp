@@ -16,6 +16,7 @@ PLUGIN_EXPORT bool Run(const string_view command, Reference<GView::Object> objec
 PLUGIN_EXPORT void UpdateSettings(IniSection sect)
 {
     sect["Command.EntropyVisualizer"] = Input::Key::F12;
+    sect[CACHE_ENABLED]               = true;
 }
 }
 } // namespace GView::GenericPlugins::EntropyVisualizer
@@ -1,5 +1,6 @@
 #include "EntropyVisualizer.hpp"
 
+#include <algorithm>
 #include <math.h>
 
 namespace GView::GenericPlugins::EntropyVisualizer
@@ -86,11 +87,43 @@ Color Plugin::EmbeddedObjectValueToColor(std::string_view name)
     }
 }
 
+Color Plugin::RegionTypeToColor(GView::Entropy::RegionType type)
+{
+    switch (type) {
+    case GView::Entropy::RegionType::Padding:
+        return Color::Gray;
+    case GView::Entropy::RegionType::Text:
+        return Color::Aqua;
+    case GView::Entropy::RegionType::Code:
+        return Color::Red;
+    case GView::Entropy::RegionType::Compressed:
+        return Color::Yellow;
+    case GView::Entropy::RegionType::Encrypted:
+        return Color::Green;
+    default:
+        return Color::Silver;
+    }
+}
+
+static bool IsCacheEnabled()
+{
+    auto allSettings = Application::GetAppSettings();
+    if (allSettings->HasSection("Generic.EntropyVisualizer")) {
+        return allSettings->GetSection("Generic.EntropyVisualizer").GetValue(CACHE_ENABLED).ToBool(true);
+    }
+    return true;
+}
+
 Plugin::Plugin(Reference<Object> object) : Window("Entropy Visualizer", "d:c,w:100%,h:98%", WindowFlags::FixedPosition)
 {
     auto desktop = AppCUI::Application::GetDesktop();
     this->parent = desktop->GetFocusedChild();
     this->object = object;
+    // a pyramid saved by a previous run for the same version of the file => any zoom level is drawn without reading it
+    this->cacheEnabled = IsCacheEnabled();
+    if (this->cacheEnabled) {
+        this->pyramid.Load(object);
+    }
     {
         this->canvasEntropy = Factory::CanvasViewer::Create(this, "d:lb,w:80%,h:100%", this->GetWidth(), this->GetHeight(), Controls::ViewerFlags::Border);
         auto canvas         = this->canvasEntropy->GetCanvas();
@@ -106,6 +139,7 @@ Plugin::Plugin(Reference<Object> object) : Window("Entropy Visualizer", "d:c,w:1
         entropyComboBox->AddSeparator();
         entropyComboBox->AddItem(SHANNON_ENTROPY_DATA_TYPE_OPTION_NAME, COMBO_BOX_ITEM_SHANNON_ENTROPY_DATA_TYPE);
         entropyComboBox->AddItem(EMBEDDED_OBJECTS_OPTION_NAME, COMBO_BOX_ITEM_EMBEDDED_OBJECTS);
+        entropyComboBox->AddItem(REGION_TYPES_OPTION_NAME, COMBO_BOX_ITEM_REGION_TYPES);
         // TODO: add the rest
         entropyComboBox->SetCurentItemIndex(0);
     }
@@ -132,56 +166,197 @@ Plugin::Plugin(Reference<Object> object) : Window("Entropy Visualizer", "d:c,w:1
     this->canvasEntropy->SetFocus();
 }
 
+EntropyMap& Plugin::GetEntropyMap(EntropyType type)
+{
+    // Shannon and Shannon data type use the same values
+    auto measure = BlockMeasure::Shannon;
+    if (type == EntropyType::Renyi) {
+        measure = BlockMeasure::Renyi;
+    } else if (type == EntropyType::RegionType) {
+        measure = BlockMeasure::RegionType;
+    }
+    for (auto it = entropyMaps.begin(); it != entropyMaps.end(); it++) {
+        if ((*it)->Matches(this->blockSize, measure, this->renyiAlpha)) {
+            std::rotate(entropyMaps.begin(), it, it + 1);
+            return *entropyMaps.front();
+        }
+    }
+    for (auto& map : entropyMaps) {
+        map->Stop(); // the blocks done so far are kept
+    }
+    if (this->pyramidBase) {
+        this->pyramidBase->Stop();
+    }
+    if (entropyMaps.size() == MAX_ENTROPY_MAPS) {
+        entropyMaps.pop_back();
+    }
+    entropyMaps.insert(entropyMaps.begin(), std::make_unique<EntropyMap>(this->object, this->blockSize, measure, this->renyiAlpha));
+    return *entropyMaps.front();
+}
+
+void Plugin::DrawEntropyValue(uint64 block, double value, EntropyType type, double epsilon)
+{
+    auto canvas = this->canvasEntropy->GetCanvas();
+    auto fColor = Color::Black;
+    switch (type) {
+    case EntropyType::Shannon:
+    case EntropyType::Renyi:
+        fColor = ShannonEntropyValueToColor(static_cast<uint32>(std::llround(value)));
+        break;
+    case EntropyType::ShannonDataType:
+        fColor = ShannonEntropyDataTypeValueToColor(value, epsilon);
+        break;
+    case EntropyType::RegionType:
+        fColor = RegionTypeToColor(static_cast<GView::Entropy::RegionType>(value));
+        break;
+    default:
+        break;
+    }
+    const auto maxX = canvas->GetWidth();
+    canvas->WriteSpecialCharacter(
+          static_cast<int32>(block % maxX), static_cast<int32>(block / maxX), BLOCK_SPECIAL_CHARACTER, ColorPair{ fColor, CANVAS_ENTROPY_BACKGROUND });
+}
+
+bool Plugin::DrawEntropyFromPyramidBase(EntropyType type, double epsilon)
+{
+    const auto size          = this->object->GetData().GetSize();
+    const auto baseBlockSize = EntropyPyramid::GetBaseBlockSize(size);
+    const auto baseBlocks    = this->blockSize / baseBlockSize; // base blocks in a drawn block
+    const auto renyi         = type == EntropyType::Renyi;
+
+    if (!this->pyramidBase) {
+        for (auto& map : entropyMaps) {
+            map->Stop();
+        }
+        this->pyramidBase = std::make_unique<EntropyMap>(this->object, baseBlockSize, BlockMeasure::Shannon, 0.0, true);
+    }
+    auto& map = *this->pyramidBase;
+
+    // a drawn block is the sum of the histograms of its base blocks => drawn once all of them are done
+    std::vector<uint64> tasks;
+    GView::Entropy::Histogram histogram;
+    const auto drawTasks = [&]() {
+        for (const auto task : tasks) {
+            const auto first = map.GetTaskFirstBlock(task) / baseBlocks;
+            const auto last  = (map.GetTaskFirstBlock(task) + map.GetTaskBlocksCount(task) - 1) / baseBlocks;
+            for (auto block = first; block <= last; block++) {
+                const auto start = block * baseBlocks;
+                const auto count = std::min<uint64>(baseBlocks, map.GetBlocksCount() - start);
+                if (!map.AreBlocksDone(start, count)) {
+                    continue;
+                }
+                histogram.fill(0);
+                for (auto i = start; i < start + count; i++) {
+                    const auto& counts = map.GetHistogram(i);
+                    for (uint32 value = 0; value < 256; value++) {
+                        histogram[value] += counts[value];
+                    }
+                }
+                const auto value = renyi ? GView::Entropy::RenyiEntropy(histogram, this->renyiAlpha) : GView::Entropy::ShannonEntropy(histogram);
+                DrawEntropyValue(block, value, type, epsilon);
+            }
+        }
+    };
+
+    map.GetFinishedTasks(tasks, true);
+    drawTasks();
+    if (!map.IsComplete()) {
+        map.Start();
+        LocalString<128> ls;
+        const char* format     = "[%llu/%llu] blocks...";
+        const auto blocksCount = map.GetBlocksCount();
+        auto canceled          = false;
+        ProgressStatus::Init("Computing entropy...", blocksCount);
+        while (map.WaitForTasks(ENTROPY_PROGRESS_INTERVAL)) {
+            map.GetFinishedTasks(tasks, false);
+            drawTasks();
+            const auto completed = map.GetCompletedBlocks();
+            if (ProgressStatus::Update(completed, ls.Format(format, completed, blocksCount))) {
+                canceled = true;
+                break;
+            }
+        }
+        map.Stop(); // canceled - the next draw continues from the base blocks that are not done
+        map.GetFinishedTasks(tasks, false);
+        drawTasks();
+        CHECK(!canceled && map.IsComplete(), true, "");
+    }
+
+    // any other multiple of the base block size is now computed without reading the object
+    this->pyramid.Build(size, baseBlockSize, map.TakeHistograms());
+    this->pyramidBase.reset();
+    if (this->cacheEnabled) {
+        this->pyramid.Save(this->object);
+    }
+    return true;
+}
+
 bool Plugin::DrawEntropy(EntropyType type)
 {
     CHECK(this->canvasEntropy.IsValid(), false, "");
     auto canvas = this->canvasEntropy->GetCanvas();
 
-    auto& cache              = object->GetData();
-    const auto size          = cache.GetSize();
-    const auto epsilon       = ComputeEpsilon(this->blockSize);
-    const uint32 blocksCount = static_cast<uint32>(size / this->blockSize + 1);
+    const auto size        = this->object->GetData().GetSize();
+    const auto epsilon     = ComputeEpsilon(this->blockSize);
+    const auto blocksCount = (size + this->blockSize - 1) / this->blockSize;
 
-    uint32 x         = 0;
-    uint32 y         = 0;
     uint32 maxX      = canvas->GetWidth();
-    uint32 maxY      = std::max<uint32>(blocksCount / maxX + 1 + 1, canvas->GetHeight());
+    uint32 maxY      = std::max<uint32>(static_cast<uint32>(blocksCount / maxX) + 1 + 1, canvas->GetHeight());
     const auto color = ColorPair{ Color::White, this->GetConfig()->Window.Background.Normal };
     canvas->Resize(maxX, maxY, 'X', color);
     canvas->ClearEntireSurface('X', color);
 
-    for (uint32 i = 0; i < blocksCount; i++) {
-        auto bf    = cache.Get(i * static_cast<uint64>(this->blockSize), this->blockSize, false);
-        auto value = 0.0;
-        switch (type) {
-        case EntropyType::Shannon:
-        case EntropyType::ShannonDataType:
-            value = GView::Entropy::ShannonEntropy(bf);
-            break;
-        case EntropyType::Renyi:
-            value = GView::Entropy::RenyiEntropy(bf, this->renyiAlpha);
-        default:
-            break;
+    // the histograms of the blocks of any multiple of the base block size are in the pyramid (the region types are not computed
+    // from the byte histogram)
+    const auto histogramBased = type != EntropyType::RegionType;
+    if (histogramBased && this->pyramid.CanCompute(this->blockSize)) {
+        std::vector<float> values;
+        this->pyramid.GetValues(this->blockSize, type == EntropyType::Renyi, this->renyiAlpha, values);
+        for (uint64 i = 0; i < values.size(); i++) {
+            DrawEntropyValue(i, values[i], type, epsilon);
         }
+        return true;
+    }
+    if (histogramBased && !this->pyramid.IsReady() && (this->blockSize % EntropyPyramid::GetBaseBlockSize(size) == 0)) {
+        return DrawEntropyFromPyramidBase(type, epsilon);
+    }
 
-        auto fColor = Color::Black;
-        switch (type) {
-        case EntropyType::Shannon:
-        case EntropyType::Renyi:
-            fColor = ShannonEntropyValueToColor(static_cast<uint32>(std::llround(value)));
-            break;
-        case EntropyType::ShannonDataType:
-            fColor = ShannonEntropyDataTypeValueToColor(value, epsilon);
-        default:
-            break;
+    // smaller blocks (or not aligned with the base blocks) are computed for this block size only
+    auto& map = GetEntropyMap(type);
+    std::vector<uint64> tasks;
+    const auto drawTasks = [&]() {
+        for (const auto task : tasks) {
+            const auto first = map.GetTaskFirstBlock(task);
+            const auto last  = first + map.GetTaskBlocksCount(task);
+            for (auto i = first; i < last; i++) {
+                DrawEntropyValue(i, map.GetValue(i), type, epsilon);
+            }
         }
+    };
 
-        canvas->WriteSpecialCharacter(x++, y, BLOCK_SPECIAL_CHARACTER, ColorPair{ fColor, CANVAS_ENTROPY_BACKGROUND });
-        if (x == maxX) {
-            x = 0;
-            y++;
+    // blocks computed by a previous draw with the same block size and type
+    map.GetFinishedTasks(tasks, true);
+    drawTasks();
+    if (map.IsComplete()) {
+        return true;
+    }
+
+    // the workers compute the rest while the blocks that are done are drawn
+    map.Start();
+    LocalString<128> ls;
+    const char* format = "[%llu/%llu] blocks...";
+    ProgressStatus::Init("Computing entropy...", blocksCount);
+    while (map.WaitForTasks(ENTROPY_PROGRESS_INTERVAL)) {
+        map.GetFinishedTasks(tasks, false);
+        drawTasks();
+        const auto completed = map.GetCompletedBlocks();
+        if (ProgressStatus::Update(completed, ls.Format(format, completed, blocksCount))) {
+            map.Stop(); // canceled - the next draw continues from the blocks that are not done
+            break;
         }
     }
+    map.GetFinishedTasks(tasks, false);
+    drawTasks();
 
     return true;
 }
@@ -206,6 +381,9 @@ bool Plugin::DrawEntropyLegend(EntropyType type)
     case EntropyType::Renyi:
         name = "Renyi Legend [0-8]";
         break;
+    case EntropyType::RegionType:
+        name = "Region Types Legend";
+        break;
     default:
         break;
     }
@@ -249,6 +427,19 @@ bool Plugin::DrawEntropyLegend(EntropyType type)
             x = 0;
         }
     } break;
+    case EntropyType::RegionType:
+        for (uint32 i = 0; i <= REGION_TYPES_MAX_VALUE; i++) {
+            const auto regionType = static_cast<GView::Entropy::RegionType>(i);
+            canvas->WriteSingleLineText(x, y++, GView::Entropy::RegionClassifier::GetRegionTypeName(regionType), color);
+
+            while (x < canvas->GetWidth()) {
+                canvas->WriteSpecialCharacter(x++, y, BLOCK_SPECIAL_CHARACTER, ColorPair{ RegionTypeToColor(regionType), CANVAS_ENTROPY_BACKGROUND });
+            }
+
+            y++;
+            x = 0;
+        }
+        break;
     default:
         break;
     }
@@ -424,6 +615,8 @@ void Plugin::ResizeLegendCanvas()
         newHeight = SHANNON_ENTROPY_LEGEND_DATA_TYPE_HEIGHT;
     } else if (entropy == COMBO_BOX_ITEM_EMBEDDED_OBJECTS) {
         newHeight = EMBEDDED_OBJECTS_LEGEND_HEIGHT;
+    } else if (entropy == COMBO_BOX_ITEM_REGION_TYPES) {
+        newHeight = REGION_TYPES_LEGEND_HEIGHT;
     }
 
     this->canvasLegend->Resize(this->canvasLegend->GetWidth(), newHeight);
@@ -456,6 +649,10 @@ bool Plugin::OnEvent(Reference<Control> sender, Event eventType, int controlID)
             this->DrawEmbeddedObjects();
             this->DrawEmbeddedObjectsLegend();
             break;
+        case COMBO_BOX_ITEM_REGION_TYPES:
+            this->DrawEntropy(EntropyType::RegionType);
+            this->DrawEntropyLegend(EntropyType::RegionType);
+            break;
         default:
             break;
         }
@@ -476,7 +673,7 @@ bool Plugin::OnEvent(Reference<Control> sender, Event eventType, int controlID)
             this->blockSize = this->blockSizeSelector->GetValue();
             return drawSelectedEntropyType();
         } else if (sender == this->alphaSelector.ToBase<Control>()) {
-            this->renyiAlpha = this->alphaSelector->GetValue() / 10;
+            this->renyiAlpha = this->alphaSelector->GetValue() / 10.0;
             return drawSelectedEntropyType();
         }
         break;
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "GView.hpp"
+#include "HashesCache.hpp"
 
 #include <any>
 #include <array>
+#include <condition_variable>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <thread>
 
 namespace GView::GenericPlugins::Hashes
 {
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "GView.hpp"
+
+#include <filesystem>
+#include <map>
+
+namespace GView::GenericPlugins::Hashes
+{
+using namespace AppCUI::Utils;
+
+// Digests computed for a file, saved next to it (<file>.hashes.cache - the same convention as the '.dissasm.cache' of the
+// disassembly view). They are used only while the identity of the file (path, size, last write time, inode / file index) is
+// the one from the moment they were computed.
+class HashesCache
+{
+    struct FileIdentity
+    {
+        uint64 size{ 0 };
+        int64 modified{ 0 };
+        uint64 inode{ 0 };
+        uint64 device{ 0 };
+
+        bool operator==(const FileIdentity&) const = default;
+    };
+
+    std::filesystem::path filePath;
+    std::filesystem::path cachePath;
+    FileIdentity identity;
+    std::map<std::string, std::string> digests; // "<range>|<algorithm>" => hex value
+    bool loaded{ false };
+    bool modified{ false };
+
+    static bool GetFileIdentity(const std::filesystem::path& path, FileIdentity& identity);
+
+  public:
+    static std::filesystem::path GetCacheFilePath(std::u16string_view fileLocation);
+    // "file" or the list of the selected zones
+    static std::string GetRangeKey(bool computeForFile, const std::vector<TypeInterface::SelectionZone>& selectedZones);
+
+    // false if the object is not an unmodified file on disk (the cache can not be used)
+    bool Load(Reference<GView::Object> object);
+    bool Find(std::string_view range, std::string_view algorithm, std::string& value) const;
+    void Add(std::string_view range, std::string_view algorithm, std::string_view value);
+    bool Save();
+};
+} // namespace GView::GenericPlugins::Hashes
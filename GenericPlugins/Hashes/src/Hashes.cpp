@@ -37,9 +37,14 @@ constexpr std::string_view TYPES_SHA3_512       = "Types.SHA3_512";
 constexpr std::string_view TYPES_SHAKE128       = "Types.SHAKE128";
 constexpr std::string_view TYPES_SHAKE256       = "Types.SHAKE256";
 
+constexpr std::string_view CACHE_ENABLED = "Cache";
+
 const uint32 widthPicking = 70;
 const uint32 widthShowing = 160;
 
+// chunks that can be in flight between the reader and the hash workers
+constexpr uint32 PIPELINE_SLOTS = 4;
+
 HashesDialog::HashesDialog(Reference<GView::Object> object) : Window("Hashes", "d:c,w:70,h:21", WindowFlags::ProcessReturn)
 {
     this->object = object;
@@ -591,6 +596,197 @@ void HashesDialog::SetSettingsFromFlags()
     allSettings->Save(Application::GetAppSettingsFile());
 }
 
+// Feeds the same data to several hash algorithms, each one on its own worker thread. The caller thread reads the data as views
+// (no copy) through PIPELINE_SLOTS independent readers of the object; a slot is reused only after every worker consumed its
+// chunk, so the queue between the reader and the workers is bounded and the total time is close to the one of the slowest hash.
+class HashPipeline
+{
+    struct Slot
+    {
+        DataCache reader;
+        BufferView chunk;
+        uint32 pending{ 0 }; // workers that did not consume the chunk yet
+
+        explicit Slot(DataCache&& reader) : reader(std::move(reader))
+        {
+        }
+    };
+
+    std::vector<Slot> slots;
+    std::vector<std::function<bool(BufferView)>> consumers;
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable produced, consumed;
+    uint64 published{ 0 }; // chunks given to the workers (only changed by the reader)
+    bool stopped{ false }; // no more chunks will be published
+    bool aborted{ false }; // the remaining chunks are dropped (canceled or failed)
+    bool failed{ false };
+
+    void Run(uint32 index)
+    {
+        auto& consume = consumers[index];
+        for (auto next = 0ULL;; next++)
+        {
+            Slot* slot = nullptr;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                produced.wait(guard, [&] { return aborted || stopped || next < published; });
+                if (aborted || next >= published)
+                {
+                    return;
+                }
+                slot = &slots[next % slots.size()];
+            }
+            const auto ok = consume(slot->chunk);
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                slot->pending--;
+                if (!ok)
+                {
+                    LOG_ERROR("Hash #%u failed to process a chunk!", index);
+                    failed  = true;
+                    aborted = true;
+                }
+            }
+            consumed.notify_one();
+            if (!ok)
+            {
+                produced.notify_all();
+                return;
+            }
+        }
+    }
+
+  public:
+    HashPipeline(const DataCache& data, uint32 chunkSize)
+    {
+        slots.reserve(PIPELINE_SLOTS);
+        for (auto i = 0U; i < PIPELINE_SLOTS; i++)
+        {
+            // the chunks of a slot are PIPELINE_SLOTS apart => no sequential pattern for the read-ahead
+            slots.emplace_back(data.CreateReader(chunkSize, false));
+        }
+    }
+    ~HashPipeline()
+    {
+        Finish(true);
+    }
+
+    void Add(std::function<bool(BufferView)> consumer)
+    {
+        consumers.emplace_back(std::move(consumer));
+    }
+    void Start()
+    {
+        for (auto i = 0U; i < consumers.size(); i++)
+        {
+            workers.emplace_back([this, i]() { Run(i); });
+        }
+    }
+
+    // waits for a free slot and publishes [offset, offset+size) to all the workers
+    bool Push(uint64 offset, uint32 size)
+    {
+        auto& slot = slots[published % slots.size()];
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            consumed.wait(guard, [&] { return failed || slot.pending == 0; });
+            CHECK(failed == false, false, "");
+        }
+        // no worker uses the slot until the chunk is published
+        slot.chunk = slot.reader.Get(offset, size, true);
+        CHECK(slot.chunk.IsValid(), false, "Fail to read %u bytes from offset %llu", size, offset);
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            slot.pending = static_cast<uint32>(workers.size());
+            published++;
+        }
+        produced.notify_all();
+        return true;
+    }
+
+    // waits for the workers to consume all the published chunks (or to stop right away if "abort" is set)
+    bool Finish(bool abort = false)
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopped = true;
+            aborted |= abort;
+        }
+        produced.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        workers.clear();
+        return failed == false;
+    }
+};
+
+// name of the hash in the outputs of ComputeHash
+static std::string_view GetHashName(Hashes hash)
+{
+    switch (hash)
+    {
+    case Hashes::Adler32:
+        return Adler32::GetName();
+    case Hashes::CRC16:
+        return CRC16::GetName();
+    case Hashes::CRC32_JAMCRC_0:
+        return CRC32::GetName(CRC32Type::JAMCRC_0);
+    case Hashes::CRC32_JAMCRC:
+        return CRC32::GetName(CRC32Type::JAMCRC);
+    case Hashes::CRC64_ECMA_182:
+        return CRC64::GetName(CRC64Type::ECMA_182);
+    case Hashes::CRC64_WE:
+        return CRC64::GetName(CRC64Type::WE);
+    case Hashes::MD5:
+        return "MD5";
+    case Hashes::BLAKE2S256:
+        return "BLAKE2S256";
+    case Hashes::BLAKE2B512:
+        return "BLAKE2B512";
+    case Hashes::SHA1:
+        return "SHA1";
+    case Hashes::SHA224:
+        return "SHA224";
+    case Hashes::SHA256:
+        return "SHA256";
+    case Hashes::SHA384:
+        return "SHA384";
+    case Hashes::SHA512:
+        return "SHA512";
+    case Hashes::SHA512_224:
+        return "SHA512_224";
+    case Hashes::SHA512_256:
+        return "SHA512_256";
+    case Hashes::SHA3_224:
+        return "SHA3_224";
+    case Hashes::SHA3_256:
+        return "SHA3_256";
+    case Hashes::SHA3_384:
+        return "SHA3_384";
+    case Hashes::SHA3_512:
+        return "SHA3_512";
+    case Hashes::SHAKE128:
+        return "SHAKE128";
+    case Hashes::SHAKE256:
+        return "SHAKE256";
+    default:
+        return "";
+    }
+}
+
+static bool IsCacheEnabled()
+{
+    auto allSettings = Application::GetAppSettings();
+    if (allSettings->HasSection("Generic.Hashes"))
+    {
+        return allSettings->GetSection("Generic.Hashes").GetValue(CACHE_ENABLED).ToBool(true);
+    }
+    return true;
+}
+
 static bool ComputeHash(
       std::map<std::string, std::string>& outputs,
       uint32 hashFlags,
@@ -600,6 +796,28 @@ static bool ComputeHash(
 {
     const auto computeForFile = computeForFileOption ? true : selectedZones.empty();
 
+    // the digests computed before for the same file (and the same range) are not computed again
+    HashesCache cache;
+    const auto range    = HashesCache::GetRangeKey(computeForFile, selectedZones);
+    const auto useCache = IsCacheEnabled() && cache.Load(object);
+    if (useCache)
+    {
+        std::string value;
+        for (const auto& hash : hashList)
+        {
+            const auto flag = hashFlags & static_cast<uint32>(hash);
+            if (flag != 0 && cache.Find(range, GetHashName(hash), value))
+            {
+                outputs.emplace(std::pair{ GetHashName(hash), value });
+                hashFlags &= ~flag;
+            }
+        }
+        if (hashFlags == static_cast<uint32>(Hashes::None))
+        {
+            return true;
+        }
+    }
+
     auto objectSize = 0ULL;
     if (computeForFile)
     {
@@ -683,85 +901,87 @@ static bool ComputeHash(
         }
     }
 
-    const auto UpdateHashOnBuffer = [&](const Buffer& buffer)
+    const auto block = object->GetData().GetCacheSize();
+    HashPipeline pipeline(object->GetData(), block);
+
+    const auto Consumer = [](auto& hash) { return [&hash](BufferView buffer) { return hash.Update(buffer); }; };
+    const auto OpenSSLConsumer = [](OpenSSLHash& hash)
+    { return [&hash](BufferView buffer) { return hash.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())); }; };
+
+    for (const auto& hash : hashList)
     {
-        for (const auto& hash : hashList)
+        switch (static_cast<Hashes>(hashFlags & static_cast<uint32>(hash)))
         {
-            switch (static_cast<Hashes>(hashFlags & static_cast<uint32>(hash)))
-            {
-            case Hashes::Adler32:
-                CHECK(adler32.Update(buffer), false, "");
-                break;
-            case Hashes::CRC16:
-                CHECK(crc16.Update(buffer), false, "");
-                break;
-            case Hashes::CRC32_JAMCRC_0:
-                CHECK(crc32JAMCRC0.Update(buffer), false, "");
-                break;
-            case Hashes::CRC32_JAMCRC:
-                CHECK(crc32JAMCRC.Update(buffer), false, "");
-                break;
-            case Hashes::CRC64_ECMA_182:
-                CHECK(crc64ECMA182.Update(buffer), false, "");
-                break;
-            case Hashes::CRC64_WE:
-                CHECK(crc64WE.Update(buffer), false, "");
-                break;
-            case Hashes::MD5:
-                CHECK(md5.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::BLAKE2S256:
-                CHECK(blake2s256.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::BLAKE2B512:
-                CHECK(blake2b512.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA1:
-                CHECK(sha1.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA224:
-                CHECK(sha224.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA256:
-                CHECK(sha256.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA384:
-                CHECK(sha384.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA512:
-                CHECK(sha512.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA512_224:
-                CHECK(sha512_224.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA512_256:
-                CHECK(sha512_256.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA3_224:
-                CHECK(sha3_224.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA3_256:
-                CHECK(sha3_256.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA3_384:
-                CHECK(sha3_384.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHA3_512:
-                CHECK(sha3_512.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHAKE128:
-                CHECK(shake128.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            case Hashes::SHAKE256:
-                CHECK(shake256.Update(buffer.GetData(), static_cast<uint32>(buffer.GetLength())), false, "");
-                break;
-            default:
-                break;
-            }
+        case Hashes::Adler32:
+            pipeline.Add(Consumer(adler32));
+            break;
+        case Hashes::CRC16:
+            pipeline.Add(Consumer(crc16));
+            break;
+        case Hashes::CRC32_JAMCRC_0:
+            pipeline.Add(Consumer(crc32JAMCRC0));
+            break;
+        case Hashes::CRC32_JAMCRC:
+            pipeline.Add(Consumer(crc32JAMCRC));
+            break;
+        case Hashes::CRC64_ECMA_182:
+            pipeline.Add(Consumer(crc64ECMA182));
+            break;
+        case Hashes::CRC64_WE:
+            pipeline.Add(Consumer(crc64WE));
+            break;
+        case Hashes::MD5:
+            pipeline.Add(OpenSSLConsumer(md5));
+            break;
+        case Hashes::BLAKE2S256:
+            pipeline.Add(OpenSSLConsumer(blake2s256));
+            break;
+        case Hashes::BLAKE2B512:
+            pipeline.Add(OpenSSLConsumer(blake2b512));
+            break;
+        case Hashes::SHA1:
+            pipeline.Add(OpenSSLConsumer(sha1));
+            break;
+        case Hashes::SHA224:
+            pipeline.Add(OpenSSLConsumer(sha224));
+            break;
+        case Hashes::SHA256:
+            pipeline.Add(OpenSSLConsumer(sha256));
+            break;
+        case Hashes::SHA384:
+            pipeline.Add(OpenSSLConsumer(sha384));
+            break;
+        case Hashes::SHA512:
+            pipeline.Add(OpenSSLConsumer(sha512));
+            break;
+        case Hashes::SHA512_224:
+            pipeline.Add(OpenSSLConsumer(sha512_224));
+            break;
+        case Hashes::SHA512_256:
+            pipeline.Add(OpenSSLConsumer(sha512_256));
+            break;
+        case Hashes::SHA3_224:
+            pipeline.Add(OpenSSLConsumer(sha3_224));
+            break;
+        case Hashes::SHA3_256:
+            pipeline.Add(OpenSSLConsumer(sha3_256));
+            break;
+        case Hashes::SHA3_384:
+            pipeline.Add(OpenSSLConsumer(sha3_384));
+            break;
+        case Hashes::SHA3_512:
+            pipeline.Add(OpenSSLConsumer(sha3_512));
+            break;
+        case Hashes::SHAKE128:
+            pipeline.Add(OpenSSLConsumer(shake128));
+            break;
+        case Hashes::SHAKE256:
+            pipeline.Add(OpenSSLConsumer(shake256));
+            break;
+        default:
+            break;
         }
-
-        return true;
-    };
+    }
 
     LocalString<512> ls;
 
@@ -771,33 +991,31 @@ static bool ComputeHash(
         format = "[0x%.16llX/0x%.16llX] bytes...";
     }
 
-    const auto block = object->GetData().GetCacheSize();
-
+    auto processed               = 0ULL;
+    const auto fileSize          = object->GetData().GetSize();
     const auto UpdateHashOnBlock = [&](uint64 offset, uint64 left)
     {
-        do
+        if (offset >= fileSize)
         {
-            CHECK(ProgressStatus::Update(offset, ls.Format(format, offset, objectSize)) == false, false, "");
-
-            const auto sizeToRead = (left >= block ? block : left);
-            left -= (left >= block ? block : left);
-
-            const Buffer buffer = object->GetData().CopyToBuffer(offset, static_cast<uint32>(sizeToRead), true);
-            CHECK(buffer.IsValid(), false, "");
-
-            CHECK(UpdateHashOnBuffer(buffer), false, "");
-
-            offset += sizeToRead;
-        } while (left > 0);
-
+            return true;
+        }
+        left = std::min<uint64>(left, fileSize - offset);
+        while (left > 0)
+        {
+            const auto size = static_cast<uint32>(std::min<uint64>(left, block));
+            CHECK(ProgressStatus::Update(processed, ls.Format(format, processed, objectSize)) == false, false, "");
+            CHECK(pipeline.Push(offset, size), false, "");
+            offset += size;
+            left -= size;
+            processed += size;
+        }
         return true;
     };
 
+    pipeline.Start();
     if (computeForFile)
     {
-        const auto offset = 0ULL;
-        const auto left   = object->GetData().GetSize();
-        CHECK(UpdateHashOnBlock(offset, left), false, "");
+        CHECK(UpdateHashOnBlock(0, fileSize), false, "");
     }
     else
     {
@@ -808,6 +1026,7 @@ static bool ComputeHash(
             CHECK(UpdateHashOnBlock(offset, left), false, "");
         }
     }
+    CHECK(pipeline.Finish(), false, "");
 
     NumericFormatter nf;
     for (const auto& hash : hashList)
@@ -886,7 +1105,7 @@ static bool ComputeHash(
             outputs.emplace(std::pair{ "SHA3_384", sha3_384.GetHexValue() });
             break;
         case Hashes::SHA3_512:
-            sha3_384.Final();
+            sha3_512.Final();
             outputs.emplace(std::pair{ "SHA3_512", sha3_512.GetHexValue() });
             break;
         case Hashes::SHAKE128:
@@ -902,6 +1121,15 @@ static bool ComputeHash(
         }
     }
 
+    if (useCache)
+    {
+        for (const auto& [name, value] : outputs)
+        {
+            cache.Add(range, name, value);
+        }
+        cache.Save(); // not an error if it can not be saved (e.g. read-only media)
+    }
+
     return true;
 }
 } // namespace GView::GenericPlugins::Hashes
@@ -1004,5 +1232,7 @@ extern "C"
         sect[GView::GenericPlugins::Hashes::TYPES_SHA3_512]       = true;
         sect[GView::GenericPlugins::Hashes::TYPES_SHAKE128]       = true;
         sect[GView::GenericPlugins::Hashes::TYPES_SHAKE256]       = true;
+
+        sect[GView::GenericPlugins::Hashes::CACHE_ENABLED] = true;
     }
 }
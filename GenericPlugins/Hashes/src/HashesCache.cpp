@@ -0,0 +1,175 @@
+#include "HashesCache.hpp"
+
+#include <fstream>
+
+#if defined(BUILD_FOR_WINDOWS)
+#    include <Windows.h>
+#    undef GetObject
+#else
+#    include <sys/stat.h>
+#endif
+
+namespace GView::GenericPlugins::Hashes
+{
+constexpr std::string_view CACHE_HEADER = "GView.HashesCache 1";
+
+bool HashesCache::GetFileIdentity(const std::filesystem::path& path, FileIdentity& identity)
+{
+    std::error_code ec;
+    identity.size = std::filesystem::file_size(path, ec);
+    CHECK(!ec, false, "Fail to get the size of: %s", path.u8string().c_str());
+    identity.modified = static_cast<int64>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+    CHECK(!ec, false, "Fail to get the last write time of: %s", path.u8string().c_str());
+
+#if defined(BUILD_FOR_WINDOWS)
+    auto file = CreateFileW(
+          path.wstring().c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+    CHECK(file != INVALID_HANDLE_VALUE, false, "Fail to open: %s", path.u8string().c_str());
+    BY_HANDLE_FILE_INFORMATION info{};
+    const auto ok = GetFileInformationByHandle(file, &info);
+    CloseHandle(file);
+    CHECK(ok, false, "Fail to get the file index of: %s", path.u8string().c_str());
+    identity.inode  = (static_cast<uint64>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    identity.device = info.dwVolumeSerialNumber;
+#else
+    struct stat info
+    {
+    };
+    CHECK(stat(path.c_str(), &info) == 0, false, "Fail to get the inode of: %s", path.u8string().c_str());
+    identity.inode  = static_cast<uint64>(info.st_ino);
+    identity.device = static_cast<uint64>(info.st_dev);
+#endif
+    return true;
+}
+
+std::filesystem::path HashesCache::GetCacheFilePath(std::u16string_view fileLocation)
+{
+    std::filesystem::path path = fileLocation;
+    path += ".hashes.cache";
+    return path;
+}
+
+std::string HashesCache::GetRangeKey(bool computeForFile, const std::vector<TypeInterface::SelectionZone>& selectedZones)
+{
+    if (computeForFile)
+    {
+        return "file";
+    }
+    std::string key;
+    LocalString<64> zone;
+    for (const auto& sz : selectedZones)
+    {
+        key += zone.Format("%s%llX-%llX", key.empty() ? "" : ",", sz.start, sz.end);
+    }
+    return key;
+}
+
+bool HashesCache::Load(Reference<GView::Object> object)
+{
+    loaded = false;
+    digests.clear();
+    // only the content of a file that was not modified (the one from the disk) can be cached
+    if ((object->GetObjectType() != GView::Object::Type::File) || (object->GetData().HasPatches()))
+    {
+        return false;
+    }
+
+    filePath  = std::filesystem::path(object->GetPath());
+    cachePath = GetCacheFilePath(object->GetPath());
+    CHECK(GetFileIdentity(filePath, identity), false, "");
+    // the size of the object must be the one of the file (e.g. not a file that is still being written)
+    if (identity.size != object->GetData().GetSize())
+    {
+        return false;
+    }
+    loaded = true;
+
+    std::ifstream file(cachePath);
+    if (!file.is_open())
+    {
+        return true; // nothing computed yet
+    }
+
+    // header, path, identity - any difference means that the digests are from another file or another version of the file
+    std::string line;
+    FileIdentity saved;
+    CHECK(std::getline(file, line) && line == CACHE_HEADER, true, "Invalid cache: %s", cachePath.u8string().c_str());
+    CHECK(std::getline(file, line), true, "Invalid cache: %s", cachePath.u8string().c_str());
+    if (line != reinterpret_cast<const char*>(filePath.u8string().c_str()))
+    {
+        return true;
+    }
+    CHECK(file >> saved.size >> saved.modified >> saved.inode >> saved.device, true, "Invalid cache: %s", cachePath.u8string().c_str());
+    if (saved != identity)
+    {
+        return true; // the file was changed since the digests were computed
+    }
+    std::getline(file, line);
+
+    while (std::getline(file, line))
+    {
+        const auto separator = line.rfind('=');
+        if (separator == std::string::npos)
+        {
+            continue;
+        }
+        digests[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+    return true;
+}
+
+bool HashesCache::Find(std::string_view range, std::string_view algorithm, std::string& value) const
+{
+    CHECK(loaded, false, "");
+    std::string key;
+    key.append(range).append("|").append(algorithm);
+    const auto it = digests.find(key);
+    if (it == digests.end())
+    {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+void HashesCache::Add(std::string_view range, std::string_view algorithm, std::string_view value)
+{
+    if (!loaded)
+    {
+        return;
+    }
+    std::string key;
+    key.append(range).append("|").append(algorithm);
+    auto& digest = digests[key];
+    if (digest != value)
+    {
+        digest   = value;
+        modified = true;
+    }
+}
+
+bool HashesCache::Save()
+{
+    CHECK(loaded, false, "");
+    if (!modified)
+    {
+        return true;
+    }
+    // the file might have changed while it was hashed => the digests would be wrong for the new identity
+    FileIdentity current;
+    CHECK(GetFileIdentity(filePath, current) && current == identity, false, "The file changed while it was hashed: %s", filePath.u8string().c_str());
+
+    std::ofstream file(cachePath, std::ios::out | std::ios::trunc);
+    CHECK(file.is_open(), false, "Fail to create: %s", cachePath.u8string().c_str());
+    file << CACHE_HEADER << "\n" << reinterpret_cast<const char*>(filePath.u8string().c_str()) << "\n";
+    file << identity.size << " " << identity.modified << " " << identity.inode << " " << identity.device << "\n";
+    for (const auto& [key, value] : digests)
+    {
+        file << key << "=" << value << "\n";
+    }
+    file.close();
+    CHECK(file.good(), false, "Fail to write: %s", cachePath.u8string().c_str());
+    modified = false;
+    return true;
+}
+} // namespace GView::GenericPlugins::Hashes
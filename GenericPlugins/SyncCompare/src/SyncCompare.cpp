@@ -14,6 +14,7 @@ constexpr int BTN_ID_OK     = 1;
 constexpr int BTN_ID_CANCEL = 2;
 
 constexpr std::string_view VIEW_NAME{ "Buffer View" };
+constexpr std::string_view CACHE_ENABLED{ "Cache" }; // the block indexes are saved next to the files (<file>.blocks.cache)
 
 constexpr ColorPair MATCH_PARTIAL{ Color::Black, Color::Yellow };
 constexpr ColorPair MATCH_COMPLETE{ Color::Black, Color::Green };
@@ -339,6 +340,51 @@ bool Plugin::ToggleSync()
     return true;
 }
 
+static bool IsCacheEnabled()
+{
+    auto allSettings = Application::GetAppSettings();
+    if (allSettings->HasSection("Generic.SyncCompare"))
+    {
+        return allSettings->GetSection("Generic.SyncCompare").GetValue(CACHE_ENABLED).ToBool(true);
+    }
+    return true;
+}
+
+// bytes that can be skipped from the current offsets: the whole blocks with identical digests in all the objects
+static uint64 GetIdenticalBlocksSize(const std::vector<GView::Hashes::BlockIndex*>& indexes, const std::vector<ViewData>& viewsData)
+{
+    if (indexes.size() < 2)
+    {
+        return 0;
+    }
+    uint64 size{ GView::Utils::INVALID_OFFSET };
+    for (size_t i = 1; (i < indexes.size()) && (size > 0); i++)
+    {
+        size = std::min<uint64>(size, indexes[0]->GetIdenticalSize(viewsData[0].viewStartOffset, *indexes[i], viewsData[i].viewStartOffset, size));
+    }
+    return size;
+}
+
+// bytes until the start of the next block (if the blocks are at the same position in all the objects) - only these are compared
+// one by one, the next blocks can then be skipped if they are identical
+static uint64 GetSizeToNextBlock(const std::vector<GView::Hashes::BlockIndex*>& indexes, const std::vector<ViewData>& viewsData)
+{
+    if ((indexes.size() < 2) || !indexes[0]->IsReady())
+    {
+        return GView::Utils::INVALID_OFFSET;
+    }
+    const auto blockSize = indexes[0]->GetBlockSize();
+    const auto position  = viewsData[0].viewStartOffset % blockSize;
+    for (size_t i = 0; i < indexes.size(); i++)
+    {
+        if (!indexes[i]->IsReady() || (indexes[i]->GetBlockSize() != blockSize) || (viewsData[i].viewStartOffset % blockSize != position))
+        {
+            return GView::Utils::INVALID_OFFSET;
+        }
+    }
+    return blockSize - position;
+}
+
 bool Plugin::FindNextDifference()
 {
     auto desktop         = AppCUI::Application::GetDesktop();
@@ -353,6 +399,11 @@ bool Plugin::FindNextDifference()
     std::vector<ViewData> viewsData;
     viewsData.reserve(windowsNo);
 
+    // computed in background the first time => the first searches might not use them
+    std::vector<GView::Hashes::BlockIndex*> indexes;
+    indexes.reserve(windowsNo);
+    const auto useIndexFiles = IsCacheEnabled();
+
     for (uint32 i = 0; i < windowsNo; i++)
     {
         auto window         = desktop->GetChild(i);
@@ -363,6 +414,7 @@ bool Plugin::FindNextDifference()
         {
             views.push_back(view);
             caches.push_back(&interface->GetObject()->GetData());
+            indexes.push_back(&interface->GetObject()->GetBlockIndex(useIndexFiles));
 
             auto& vd = viewsData.emplace_back();
             view->GetViewData(vd, GView::Utils::INVALID_OFFSET);
@@ -383,6 +435,17 @@ bool Plugin::FindNextDifference()
     bool differenceNotFound{ true };
     do
     {
+        const auto identicalSize = GetIdenticalBlocksSize(indexes, viewsData);
+        if (identicalSize > 0)
+        {
+            for (auto& data : viewsData)
+            {
+                data.viewStartOffset += identicalSize;
+            }
+            continue;
+        }
+        const auto size = std::min<uint64>(bufferSize, GetSizeToNextBlock(indexes, viewsData));
+
         std::vector<BufferView> buffers;
         buffers.reserve(windowsNo);
 
@@ -391,13 +454,13 @@ bool Plugin::FindNextDifference()
             auto& view             = views.at(i);
             auto& data             = viewsData.at(i);
             auto& cache            = caches.at(i);
-            buffers.emplace_back() = cache->Get(data.viewStartOffset, static_cast<uint32>(bufferSize), false);
+            buffers.emplace_back() = cache->Get(data.viewStartOffset, static_cast<uint32>(size), false);
         }
 
         uint32 i = 0;
         std::vector<char> bytes;
         bytes.reserve(windowsNo);
-        for (; i < bufferSize; i++)
+        for (; i < size; i++)
         {
             for (const auto& buffer : buffers)
             {
@@ -541,5 +604,6 @@ extern "C"
         sect["Command.ToggleSync"]         = Input::Key::Shift | Input::Key::Space;
         sect["Command.FindNextDifference"] = Input::Key::Shift | Input::Key::F11;
         sect["Command.FindNextDC"]         = Input::Key::Ctrl | Input::Key::Shift | Input::Key::F11;
+        sect[CACHE_ENABLED]                = true;
     }
 }
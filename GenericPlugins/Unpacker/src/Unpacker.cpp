@@ -168,7 +168,7 @@ bool Plugin::DecodeBase64(BufferView input, uint64 start, uint64 end)
         fullPath.AddChar((char16_t) std::filesystem::path::preferred_separator);
         fullPath.Add(name);
 
-        GView::App::OpenBuffer(output, name, fullPath, GView::App::OpenMethod::BestMatch, "", this->parent);
+        GView::App::OpenBuffer(std::move(output), name, fullPath, GView::App::OpenMethod::BestMatch, "", this->parent);
         return true;
     }
 
@@ -190,7 +190,7 @@ bool Plugin::DecodeQuotedPrintable(BufferView input, uint64 start, uint64 end)
         fullPath.AddChar((char16_t) std::filesystem::path::preferred_separator);
         fullPath.Add(name);
 
-        GView::App::OpenBuffer(output, name, fullPath, GView::App::OpenMethod::BestMatch, "", this->parent);
+        GView::App::OpenBuffer(std::move(output), name, fullPath, GView::App::OpenMethod::BestMatch, "", this->parent);
         return true;
     }
 
@@ -227,8 +227,7 @@ bool Plugin::DecodeZLib(BufferView input, uint64 start, uint64 end)
             std::string path;
             fullPath.ToString(path);
 
-            Data data{ output, name, String{ path } };
-            outputs.emplace_back(data);
+            outputs.emplace_back(Data{ std::move(output), name, String{ path } });
         } else {
             LocalString<256> title;
             title.Format("Error for area %llx -> %llx!", start, end);
@@ -239,8 +238,8 @@ bool Plugin::DecodeZLib(BufferView input, uint64 start, uint64 end)
         input = { input.GetData() + sizeConsumed, input.GetLength() - sizeConsumed };
     } while (sizeConsumed < input.GetLength() && sizeConsumed > 0);
 
-    for (const auto& output : outputs) {
-        GView::App::OpenBuffer(output.buffer, output.name, output.path, GView::App::OpenMethod::BestMatch, "", this->parent);
+    for (auto& output : outputs) {
+        GView::App::OpenBuffer(std::move(output.buffer), output.name, output.path, GView::App::OpenMethod::BestMatch, "", this->parent);
     }
 
     return !outputs.empty();
@@ -39,57 +39,59 @@ bool GView::Type::CSV::CSVFile::HasPanel(Panels::IDs id)
 void GView::Type::CSV::CSVFile::UpdateBufferViewZones(GView::View::BufferViewer::Settings& settings)
 {
     const auto color = ColorPair{ Color::Gray, Color::Transparent };
-
     const auto oSize = obj->GetData().GetSize();
-    const auto cSize = obj->GetData().GetCacheSize();
 
-    auto oSizeProcessed = 0ULL;
-    auto currentLine    = 0ULL;
+    auto lineStart   = 0ULL;
+    auto currentLine = 0ULL;
+    char pending     = 0; // line terminator found at the end of the previous chunk (it might be followed by its pair - \r\n or \n\r)
 
-    do
+    const auto AddLine = [&](uint64 lineEnd)
     {
-        const auto buf = obj->GetData().Get(oSizeProcessed, static_cast<uint32>(cSize), false);
-        const std::string_view data{ reinterpret_cast<const char*>(buf.GetData()), buf.GetLength() };
-
-        const auto nPos = data.find_first_of('\n', 0);
-        const auto rPos = data.find_first_of('\r', 0);
-
-        const auto oldOSizeProcessed = oSizeProcessed;
-
-        if (nPos < rPos)
-        {
-            if (nPos + 1 < data.size() && data[nPos + 1] == '\r')
-            {
-                oSizeProcessed += nPos + 2;
-            }
-            else
-            {
-                oSizeProcessed += nPos + 1;
-            }
-        }
-        else if (nPos > rPos)
-        {
-            if (rPos + 1 < data.size() && data[rPos + 1] == '\n')
-            {
-                oSizeProcessed += rPos + 2;
-            }
-            else
-            {
-                oSizeProcessed += rPos + 1;
-            }
-        }
-        else // last line EOF
-        {
-            settings.AddZone(oldOSizeProcessed, oSize - oldOSizeProcessed, color, std::to_string(currentLine));
-            currentLine++;
-            break;
-        }
-
-        settings.AddZone(oldOSizeProcessed, oSizeProcessed - oldOSizeProcessed, color, std::to_string(currentLine));
-
+        settings.AddZone(lineStart, lineEnd - lineStart, color, std::to_string(currentLine));
         currentLine++;
-
-    } while (oSizeProcessed < oSize);
+        lineStart = lineEnd;
+    };
+    const auto IsPair = [](char terminator, char next) { return (next == '\r' || next == '\n') && next != terminator; };
+
+    obj->GetData().ForEachChunk(
+          0,
+          oSize,
+          0,
+          0,
+          [&](uint64 chunkOffset, BufferView buf)
+          {
+              const std::string_view data{ reinterpret_cast<const char*>(buf.GetData()), buf.GetLength() };
+
+              size_t pos = 0;
+              if (pending != 0)
+              {
+                  pos = IsPair(pending, data[0]) ? 1 : 0;
+                  AddLine(chunkOffset + pos);
+                  pending = 0;
+              }
+
+              while ((pos = data.find_first_of("\r\n", pos)) != std::string_view::npos)
+              {
+                  if (pos + 1 == data.size())
+                  {
+                      pending = data[pos];
+                      break;
+                  }
+                  pos += IsPair(data[pos], data[pos + 1]) ? 2 : 1;
+                  AddLine(chunkOffset + pos);
+              }
+
+              return true;
+          });
+
+    if (pending != 0)
+    {
+        AddLine(oSize);
+    }
+    if (lineStart < oSize) // last line EOF
+    {
+        AddLine(oSize);
+    }
 }
 
 void GView::Type::CSV::CSVFile::UpdateGrid(GView::View::GridViewer::Settings& settings)
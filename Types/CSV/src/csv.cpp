@@ -63,6 +63,66 @@ extern "C"
         return true;
     }
 
+    PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+    {
+        auto csv = obj->GetContentType<CSV::CSVFile>();
+        CHECK(csv->Update(obj), false, "");
+
+        const auto separator = obj->GetName().ends_with(u".tsv") ? '\t' : ',';
+        const auto size      = obj->GetData().GetSize();
+
+        // separators and line terminators inside quoted values do not count
+        auto rows           = 0ULL;
+        auto columns        = 0ULL;
+        auto currentColumns = 1ULL;
+        auto quoted         = false;
+        auto emptyLine      = true;
+        obj->GetData().ForEachChunk(
+              0,
+              size,
+              0,
+              0,
+              [&](uint64 chunkOffset, BufferView buf)
+              {
+                  for (auto i = 0U; i < buf.GetLength(); i++)
+                  {
+                      const auto c = buf[i];
+                      if (c == '"')
+                      {
+                          quoted = !quoted;
+                      }
+                      else if (quoted == false && (c == '\r' || c == '\n'))
+                      {
+                          if (emptyLine == false)
+                          {
+                              rows++;
+                              columns = std::max(columns, currentColumns);
+                          }
+                          currentColumns = 1;
+                          emptyLine      = true;
+                          continue;
+                      }
+                      else if (quoted == false && c == separator)
+                      {
+                          currentColumns++;
+                      }
+                      emptyLine = false;
+                  }
+                  return true;
+              });
+        if (emptyLine == false) // last line EOF
+        {
+            rows++;
+            columns = std::max(columns, currentColumns);
+        }
+
+        output->AddString("separator", separator == '\t' ? "tab" : "comma");
+        output->AddNumber("rows", rows);
+        output->AddNumber("columns", columns);
+
+        return true;
+    }
+
     PLUGIN_EXPORT void UpdateSettings(IniSection sect)
     {
         sect["Extension"]   = { "csv", "tsv" };
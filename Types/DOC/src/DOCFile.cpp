@@ -473,7 +473,7 @@ void DOCFile::DisplayAllVBAProjectFiles(CFDirEntry& entry)
     if (type == 0x02) {
         Buffer entryBuffer = DOCFile::OpenCFStream(entry);
 
-        GView::App::OpenBuffer(entryBuffer, name, "", GView::App::OpenMethod::BestMatch, "bin");
+        GView::App::OpenBuffer(std::move(entryBuffer), name, "", GView::App::OpenMethod::BestMatch, "bin");
     }
 
     for (auto& child : entry.children) {
@@ -670,6 +670,6 @@ void DOCFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
     if (!ParseModuleStream(moduleBuffer, moduleRecord, decompressed)) {
         AppCUI::Dialogs::MessageBox::ShowError("Error", "Module parse error!");
     }
-    GView::App::OpenBuffer(decompressed, moduleRecord->streamName, "", GView::App::OpenMethod::ForceType, "VBA");
+    GView::App::OpenBuffer(std::move(decompressed), moduleRecord->streamName, "", GView::App::OpenMethod::ForceType, "VBA");
 }
 } // namespace GView::Type::DOC
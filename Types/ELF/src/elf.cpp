@@ -168,6 +168,99 @@ extern "C"
         return true;
     }
 
+    PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+    {
+        auto elf = obj->GetContentType<ELF::ELFFile>();
+        CHECK(elf->Update(), false, "");
+
+        // the 32 and 64 bits structures have the same field names
+        auto addHeader = [&](const auto& header)
+        {
+            output->BeginObject("header");
+            output->AddBool("is64", elf->is64);
+            output->AddBool("isLittleEndian", elf->isLittleEndian);
+            output->AddString("osAbi", ELF::GetNameFromElfOsAbi(header.e_ident[ELF::EI_OSABI]));
+            output->AddString("type", ELF::GetNameAndDecriptionFromElfType(header.e_type).first);
+            output->AddString("machine", ELF::GetNameFromElfMachine(header.e_machine));
+            output->AddNumber("entryPoint", header.e_entry);
+            output->AddNumber("flags", header.e_flags);
+            output->EndObject();
+        };
+        auto addSegments = [&](const auto& segments)
+        {
+            output->BeginArray("segments");
+            for (const auto& segment : segments)
+            {
+                output->BeginObject();
+                output->AddString("type", ELF::GetNameFromElfProgramHeaderType(segment.p_type));
+                output->AddNumber("offset", segment.p_offset);
+                output->AddNumber("virtualAddress", segment.p_vaddr);
+                output->AddNumber("fileSize", segment.p_filesz);
+                output->AddNumber("memorySize", segment.p_memsz);
+                output->AddString("permissions", ELF::GetPermissionsFromSegmentFlags(segment.p_flags));
+                output->EndObject();
+            }
+            output->EndArray();
+        };
+        auto addSections = [&](const auto& sections)
+        {
+            output->BeginArray("sections");
+            for (size_t index = 0; index < sections.size(); index++)
+            {
+                const auto& section = sections[index];
+                output->BeginObject();
+                if (index < elf->sectionNames.size())
+                    output->AddString("name", elf->sectionNames[index]);
+                output->AddString("type", ELF::GetNameFromSectionType(section.sh_type));
+                output->AddNumber("flags", section.sh_flags);
+                output->AddNumber("address", section.sh_addr);
+                output->AddNumber("offset", section.sh_offset);
+                output->AddNumber("size", section.sh_size);
+                output->EndObject();
+            }
+            output->EndArray();
+        };
+        auto addSymbols = [&](std::string_view key, const auto& symbols, const std::vector<std::string>& names)
+        {
+            output->BeginArray(key);
+            for (size_t index = 0; index < symbols.size(); index++)
+            {
+                const auto& symbol = symbols[index];
+                output->BeginObject();
+                if (index < names.size())
+                    output->AddString("name", names[index]);
+                output->AddNumber("value", symbol.st_value);
+                output->AddNumber("size", symbol.st_size);
+                output->AddString("binding", ELF::GetNameFromSymbolBinding(ELF_ST_BIND(symbol.st_info)));
+                output->AddString("type", ELF::GetNameFromSymbolType(ELF_ST_TYPE(symbol.st_info)));
+                output->AddNumber("sectionIndex", symbol.st_shndx);
+                output->EndObject();
+            }
+            output->EndArray();
+        };
+
+        if (elf->is64)
+        {
+            addHeader(elf->header64);
+            addSegments(elf->segments64);
+            addSections(elf->sections64);
+            addSymbols("staticSymbols", elf->staticSymbols64, elf->staticSymbolsNames);
+            addSymbols("dynamicSymbols", elf->dynamicSymbols64, elf->dynamicSymbolsNames);
+        }
+        else
+        {
+            addHeader(elf->header32);
+            addSegments(elf->segments32);
+            addSections(elf->sections32);
+            addSymbols("staticSymbols", elf->staticSymbols32, elf->staticSymbolsNames);
+            addSymbols("dynamicSymbols", elf->dynamicSymbols32, elf->dynamicSymbolsNames);
+        }
+        if (!elf->gnuString.empty())
+            output->AddString("gnu", elf->gnuString);
+
+        return true;
+    }
+
     PLUGIN_EXPORT void UpdateSettings(IniSection sect)
     {
         sect["Pattern"]      = "magic:7F 45 4C 46";
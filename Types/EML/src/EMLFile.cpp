@@ -146,13 +146,13 @@ void EMLFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
                         AppCUI::Dialogs::MessageBox::ShowError("Warning!", warningMessage);
                     }
 
-                    GView::App::OpenBuffer(output, bufferName, path, GView::App::OpenMethod::BestMatch);
+                    GView::App::OpenBuffer(std::move(output), bufferName, path, GView::App::OpenMethod::BestMatch);
                 } else {
                     AppCUI::Dialogs::MessageBox::ShowError("Error!", "Malformed base64 buffer!");
                 }
             } else if (encodingHeader->second == u"quoted-printable") {
                 if (GView::Decoding::QuotedPrintable::Decode(itemBufferView, output)) {
-                    GView::App::OpenBuffer(output, bufferName, path, GView::App::OpenMethod::BestMatch);
+                    GView::App::OpenBuffer(std::move(output), bufferName, path, GView::App::OpenMethod::BestMatch);
                 } else {
                     AppCUI::Dialogs::MessageBox::ShowError("Error!", "Malformed quoted-printable buffer!");
                 }
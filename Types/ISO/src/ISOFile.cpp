@@ -190,7 +190,6 @@ void ISOFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
     auto data         = item.GetData<ECMA_119_DirectoryRecord>();
     const auto offset = (uint64) data->locationOfExtent.LSB * pvd.vdd.logicalBlockSize.LSB;
     const auto length = (uint32) data->dataLength.LSB;
-    const auto buffer = obj->GetData().CopyToBuffer(offset, length);
 
     LocalString<64> ls;
     ls.Format("_0x%x_0x%x.bin", offset, length);
@@ -201,5 +200,5 @@ void ISOFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
     auto fullPath = std::u16string{ path.data(), path.size() };
     fullPath.append(lus.ToStringView());
 
-    GView::App::OpenBuffer(buffer, name, fullPath, GView::App::OpenMethod::BestMatch);
+    GView::App::OpenRange(obj, offset, length, name, fullPath, GView::App::OpenMethod::BestMatch);
 }
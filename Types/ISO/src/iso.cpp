@@ -174,6 +174,45 @@ extern "C"
         return true;
     }
 
+    PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+    {
+        auto iso = obj->GetContentType<ISO::ISOFile>();
+        CHECK(iso->Update(), false, "");
+
+        output->BeginArray("volumeDescriptors");
+        for (const auto& entry : iso->headers)
+        {
+            output->BeginObject();
+            output->AddString("type", ISO::GetSectorTypeName(entry.header.type));
+            output->AddNumber("offset", entry.offsetInFile);
+            output->EndObject();
+        }
+        output->EndArray();
+
+        const auto& vdd = iso->pvd.vdd;
+        output->BeginObject("primaryVolume");
+        output->AddString("systemIdentifier", std::string_view{ vdd.systemIdentifier, sizeof(vdd.systemIdentifier) });
+        output->AddString("volumeIdentifier", std::string_view{ vdd.volumeIdentifier, sizeof(vdd.volumeIdentifier) });
+        output->AddNumber("volumeSpaceSize", vdd.volumeSpaceSize.LSB);
+        output->AddNumber("logicalBlockSize", vdd.logicalBlockSize.LSB);
+        output->EndObject();
+
+        output->BeginArray("records");
+        for (const auto& record : iso->records)
+        {
+            output->BeginObject();
+            output->AddString("name", std::string_view{ record.fileIdentifier, record.lengthOfFileIdentifier });
+            output->AddBool("isDirectory", (record.fileFlags & ISO::ECMA_119_FileFlags::Directory) != 0);
+            output->AddNumber("offset", (uint64) record.locationOfExtent.LSB * vdd.logicalBlockSize.LSB);
+            output->AddNumber("size", record.dataLength.LSB);
+            output->AddString("created", ISO::RecordingDateAndTimeToString(record.recordingDateAndTime));
+            output->EndObject();
+        }
+        output->EndArray();
+
+        return true;
+    }
+
     PLUGIN_EXPORT void UpdateSettings(IniSection sect)
     {
         sect["Pattern"]     = "magic:00 00 00 00 00 00 00 00";
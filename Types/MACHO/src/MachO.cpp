@@ -237,6 +237,102 @@ extern "C"
         return true;
     }
 
+    PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+    {
+        auto machO = obj->GetContentType<MachO::MachOFile>();
+        CHECK(machO->Update(), false, "");
+
+        output->AddBool("isFat", machO->isFat);
+        if (machO->isFat)
+        {
+            output->BeginArray("archs");
+            for (const auto& arch : machO->archs)
+            {
+                output->BeginObject();
+                output->AddString("name", arch.info.name);
+                output->AddNumber("cpuType", static_cast<uint32>(arch.cputype));
+                output->AddNumber("offset", arch.offset);
+                output->AddNumber("size", arch.size);
+                output->EndObject();
+            }
+            output->EndArray();
+            return true;
+        }
+
+        const auto& info    = MAC::GetArchInfoFromCPUTypeAndSubtype(machO->header.cputype, machO->header.cpusubtype);
+        const auto fileType = MAC::FileTypeNames.find(machO->header.filetype);
+        output->BeginObject("header");
+        output->AddBool("is64", machO->is64);
+        output->AddString("cpu", info.name);
+        output->AddString("cpuSubtype", info.description);
+        if (fileType != MAC::FileTypeNames.end())
+            output->AddString("fileType", fileType->second);
+        output->AddNumber("loadCommands", machO->header.ncmds);
+        output->AddNumber("flags", machO->header.flags);
+        output->EndObject();
+
+        output->BeginArray("segments");
+        for (const auto& segment : machO->segments)
+        {
+            output->BeginObject();
+            output->AddString("name", std::string_view{ segment.segname, strnlen(segment.segname, sizeof(segment.segname)) });
+            output->AddNumber("virtualAddress", segment.vmaddr);
+            output->AddNumber("virtualSize", segment.vmsize);
+            output->AddNumber("fileOffset", segment.fileoff);
+            output->AddNumber("fileSize", segment.filesize);
+            output->AddNumber("initProtection", segment.initprot);
+            output->AddNumber("maxProtection", segment.maxprot);
+            output->BeginArray("sections");
+            for (const auto& section : segment.sections)
+            {
+                output->BeginObject();
+                output->AddString("name", std::string_view{ section.sectname, strnlen(section.sectname, sizeof(section.sectname)) });
+                output->AddNumber("address", section.addr);
+                output->AddNumber("size", section.size);
+                output->AddNumber("offset", section.offset);
+                output->AddNumber("flags", section.flags);
+                output->EndObject();
+            }
+            output->EndArray();
+            output->EndObject();
+        }
+        output->EndArray();
+
+        output->BeginArray("dylibs");
+        for (const auto& dylib : machO->dylibs)
+        {
+            const auto command = MAC::LoadCommandNames.find(dylib.value.cmd);
+            output->BeginObject();
+            output->AddString("name", dylib.name);
+            if (command != MAC::LoadCommandNames.end())
+                output->AddString("command", command->second);
+            output->AddNumber("currentVersion", dylib.value.dylib.current_version);
+            output->AddNumber("compatibilityVersion", dylib.value.dylib.compatibility_version);
+            output->EndObject();
+        }
+        output->EndArray();
+
+        if (machO->main.has_value())
+            output->AddNumber("entryPoint", machO->main->entryoff);
+
+        output->BeginArray("symbols");
+        if (machO->dySymTab.has_value())
+        {
+            for (const auto& symbol : machO->dySymTab->objects)
+            {
+                output->BeginObject();
+                output->AddString("name", symbol.symbolNameDemangled);
+                output->AddNumber("type", symbol.n_type);
+                output->AddNumber("section", symbol.n_sect);
+                output->AddNumber("value", symbol.n_value);
+                output->EndObject();
+            }
+        }
+        output->EndArray();
+
+        return true;
+    }
+
     PLUGIN_EXPORT void UpdateSettings(IniSection sect)
     {
         static const std::initializer_list<std::string> patterns = {
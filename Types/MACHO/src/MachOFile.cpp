@@ -1159,16 +1159,14 @@ void MachOFile::OnOpenItem(std::u16string_view, AppCUI::Controls::TreeViewItem i
 
     auto data         = item.GetData<MAC::Arch>();
     const auto offset = data->offset;
-    const auto length = (uint32) data->size;
-
-    const auto buffer = obj->GetData().CopyToBuffer(offset, length);
+    const auto length = (uint64) data->size;
 
     LocalUnicodeStringBuilder<2048> fullPath;
     fullPath.Add(this->obj->GetPath());
     fullPath.AddChar((char16_t) std::filesystem::path::preferred_separator);
     fullPath.Add(data->info.name);
 
-    GView::App::OpenBuffer(buffer, data->info.name, fullPath, GView::App::OpenMethod::BestMatch);
+    GView::App::OpenRange(obj, offset, length, data->info.name, fullPath, GView::App::OpenMethod::BestMatch);
 }
 
 bool MachOFile::UpdateKeys(KeyboardControlsInterface* interface)
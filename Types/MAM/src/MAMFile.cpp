@@ -55,7 +55,7 @@ bool MAMFile::Decompress()
     fullPath.AddChar((char16_t) std::filesystem::path::preferred_separator);
     fullPath.Add(obj->GetName());
 
-    GView::App::OpenBuffer(uncompressed, obj->GetName(), fullPath, GView::App::OpenMethod::BestMatch);
+    GView::App::OpenBuffer(std::move(uncompressed), obj->GetName(), fullPath, GView::App::OpenMethod::BestMatch);
 
     return true;
 }
@@ -120,6 +120,54 @@ extern "C"
         return true;
     }
 
+    PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+    {
+        auto pcap = obj->GetContentType<PCAP::PCAPFile>();
+        // no window => the payload parsers can not add panels (the HTTP parser only fills the application layers)
+        pcap->RegisterPayloadParser(std::make_unique<PCAP::HTTP::HTTPParser>());
+        CHECK(pcap->Update(), false, "");
+
+        const auto network = PCAP::LinkTypeNames.find(pcap->header.network);
+        output->BeginObject("header");
+        output->AddNumber("versionMajor", pcap->header.versionMajor);
+        output->AddNumber("versionMinor", pcap->header.versionMinor);
+        output->AddSignedNumber("thisZone", pcap->header.thiszone);
+        output->AddNumber("snapLength", pcap->header.snaplen);
+        if (network != PCAP::LinkTypeNames.end())
+            output->AddString("network", network->second);
+        else
+            output->AddNumber("network", static_cast<uint32>(pcap->header.network));
+        output->EndObject();
+        output->AddNumber("packets", pcap->packetHeaders.size());
+
+        for (const auto& [header, offset] : pcap->packetHeaders)
+            pcap->streamManager.AddPacket(header, pcap->header.network);
+        pcap->streamManager.FinishedAdding();
+
+        output->BeginArray("streams");
+        for (const auto& stream : pcap->streamManager)
+        {
+            output->BeginObject();
+            output->AddString("connection", stream.name);
+            const auto ipProtocol = PCAP::EtherTypeNames.find(static_cast<PCAP::EtherType>(stream.ipProtocol));
+            if (ipProtocol != PCAP::EtherTypeNames.end())
+                output->AddString("ipProtocol", ipProtocol->second);
+            const auto transport = PCAP::IP_ProtocolNames.find(static_cast<PCAP::IP_Protocol>(stream.transportProtocol));
+            if (transport != PCAP::IP_ProtocolNames.end())
+                output->AddString("transport", transport->second);
+            output->AddNumber("packets", stream.packetsOffsets.size());
+            output->AddNumber("payload", stream.totalPayload);
+            if (!stream.appLayerName.empty())
+                output->AddString("appLayer", stream.appLayerName);
+            if (!stream.summary.empty())
+                output->AddString("summary", stream.summary);
+            output->EndObject();
+        }
+        output->EndArray();
+
+        return true;
+    }
+
     PLUGIN_EXPORT void UpdateSettings(IniSection sect)
     {
         sect["Pattern"]     = { "magic:A1 B2 C3 D4", "magic:D4 C3 B2 A1" };
@@ -156,8 +156,9 @@ void PCAPFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIt
     if (layer.payload.size == 0)
         return;
 
-    uint8* payload = new uint8[layer.payload.size];
-    memcpy(payload, layer.payload.location, layer.payload.size);
+    Buffer buffer;
+    buffer.Resize(layer.payload.size);
+    memcpy(buffer.GetData(), layer.payload.location, layer.payload.size);
 
     std::string extractionName;
     if (!layer.extractionName.empty())
@@ -165,9 +166,7 @@ void PCAPFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIt
     else
         extractionName = (const char*) layer.name.get();
 
-    const Buffer buffer = { payload, layer.payload.size };
-
-    GView::App::OpenBuffer(buffer, extractionName, extractionName, GView::App::OpenMethod::BestMatch);
+    GView::App::OpenBuffer(std::move(buffer), extractionName, extractionName, GView::App::OpenMethod::BestMatch);
 }
 
 std::vector<std::pair<std::string, std::string>> PCAPFile::GetPropertiesForContainerView()
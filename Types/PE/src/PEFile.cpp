@@ -2015,23 +2015,39 @@ std::vector<uint64> PEFile::FindPcLnTabSigsCandidates() const
     std::vector<uint64> indexes;
     indexes.reserve(10); // usually not that many sigs found matching
 
+    // all signatures have the same size => an overlap of size - 1 bytes finds every match exactly once
+    constexpr uint32 sigsCount = sizeof(pclntabSigs) / sizeof(pclntabSigs[0]);
+    constexpr uint32 overlap   = static_cast<uint32>(pclntabSigs[0].size() - 1);
+
     for (uint32 i = 0; i < nrSections; i++)
     {
-        const auto sectionBuffer = obj->GetData().CopyToBuffer(sect[i].PointerToRawData, sect[i].SizeOfRawData);
-        CHECK(sectionBuffer.IsValid(), indexes, "");
-        const auto section = std::string_view{ reinterpret_cast<char*>(sectionBuffer.GetData()), sectionBuffer.GetLength() };
-
-        for (const auto& sig : pclntabSigs)
-        {
-            uint64 index = 0;
-            while ((index = section.find(sig, index)) != std::string::npos)
-            {
-                if (index != std::string::npos && index < sect[i].SizeOfRawData)
-                {
-                    indexes.push_back(index + sect[i].VirtualAddress + imageBase);
-                }
-                index += sig.size();
-            }
+        std::vector<uint64> sectionIndexes[sigsCount]; // keep the candidates grouped by signature
+        const auto completed = obj->GetData().ForEachChunk(
+              sect[i].PointerToRawData,
+              sect[i].SizeOfRawData,
+              0,
+              overlap,
+              [&](uint64 chunkOffset, BufferView chunk)
+              {
+                  const auto section = std::string_view{ reinterpret_cast<const char*>(chunk.GetData()), chunk.GetLength() };
+                  const auto base    = chunkOffset - sect[i].PointerToRawData + sect[i].VirtualAddress + imageBase;
+                  for (uint32 j = 0; j < sigsCount; j++)
+                  {
+                      const auto& sig = pclntabSigs[j];
+                      uint64 index    = 0;
+                      while ((index = section.find(sig, index)) != std::string::npos)
+                      {
+                          sectionIndexes[j].push_back(base + index);
+                          index += sig.size();
+                      }
+                  }
+                  return true;
+              });
+        CHECK(completed, indexes, "");
+
+        for (const auto& sigIndexes : sectionIndexes)
+        {
+            indexes.insert(indexes.end(), sigIndexes.begin(), sigIndexes.end());
         }
     }
 
@@ -236,6 +236,113 @@ PLUGIN_EXPORT bool PopulateWindow(Reference<GView::View::WindowInterface> win)
     return true;
 }
 
+PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+{
+    auto pe = obj->GetContentType<PE::PEFile>();
+    CHECK(pe->Update(), false, "");
+
+    const auto& fileHeader = pe->nth32.FileHeader; // same for PE32+
+    output->BeginObject("header");
+    output->AddBool("is64", pe->hdr64);
+    output->AddString("machine", pe->GetMachine());
+    output->AddString("subsystem", pe->GetSubsystem());
+    output->AddNumber("timeDateStamp", fileHeader.TimeDateStamp);
+    output->AddNumber("characteristics", fileHeader.Characteristics);
+    output->AddNumber("dllCharacteristics", pe->nth32.OptionalHeader.DllCharacteristics);
+    output->AddNumber("imageBase", pe->imageBase);
+    output->AddNumber("entryPoint", pe->rvaEntryPoint);
+    output->AddNumber("sizeOfImage", pe->nth32.OptionalHeader.SizeOfImage);
+    output->AddNumber("computedSize", pe->computedSize);
+    if (pe->dllName.Len() > 0)
+        output->AddString("dllName", pe->dllName);
+    if (pe->pdbName.Len() > 0)
+        output->AddString("pdbName", pe->pdbName);
+    output->EndObject();
+
+    String name;
+    output->BeginArray("sections");
+    for (auto index = 0U; index < pe->nrSections; index++) {
+        const auto& sect = pe->sect[index];
+        pe->GetSectionName(index, name);
+        output->BeginObject();
+        output->AddString("name", name.ToStringView());
+        output->AddNumber("virtualAddress", sect.VirtualAddress);
+        output->AddNumber("virtualSize", sect.Misc.VirtualSize);
+        output->AddNumber("rawAddress", sect.PointerToRawData);
+        output->AddNumber("rawSize", sect.SizeOfRawData);
+        output->AddNumber("characteristics", sect.Characteristics);
+        output->EndObject();
+    }
+    output->EndArray();
+
+    output->BeginArray("directories");
+    for (auto dirID = 0U; dirID < 15; dirID++) {
+        const auto& dir = pe->dirs[dirID];
+        if ((dir.VirtualAddress == 0) && (dir.Size == 0))
+            continue;
+        output->BeginObject();
+        output->AddString("name", PE::PEFile::DirectoryIDToName(dirID));
+        output->AddNumber("address", dir.VirtualAddress);
+        output->AddNumber("size", dir.Size);
+        output->EndObject();
+    }
+    output->EndArray();
+
+    // imported functions are stored in the order of their DLLs
+    output->BeginArray("imports");
+    auto fnc = pe->impFunc.cbegin();
+    for (auto index = 0U; index < pe->impDLL.size(); index++) {
+        output->BeginObject();
+        output->AddString("dll", pe->impDLL[index].Name);
+        output->AddNumber("rva", pe->impDLL[index].RVA);
+        output->BeginArray("functions");
+        for (; (fnc != pe->impFunc.cend()) && (fnc->dllIndex == index); fnc++) {
+            output->BeginObject();
+            output->AddString("name", fnc->Name.ToStringView());
+            output->AddNumber("rva", fnc->RVA);
+            output->EndObject();
+        }
+        output->EndArray();
+        output->EndObject();
+    }
+    output->EndArray();
+
+    output->BeginArray("exports");
+    for (const auto& exp : pe->exp) {
+        output->BeginObject();
+        output->AddString("name", exp.Name.ToStringView());
+        output->AddNumber("ordinal", exp.Ordinal);
+        output->AddNumber("rva", exp.RVA);
+        output->EndObject();
+    }
+    output->EndArray();
+
+    output->BeginArray("resources");
+    for (const auto& r : pe->res) {
+        output->BeginObject();
+        output->AddString("type", PE::PEFile::ResourceIDToName(r.Type));
+        output->AddNumber("id", r.ID);
+        if (r.Name.Len() > 0)
+            output->AddString("name", r.Name);
+        output->AddNumber("language", r.Language);
+        output->AddNumber("offset", r.Start);
+        output->AddNumber("size", r.Size);
+        output->EndObject();
+    }
+    output->EndArray();
+
+    output->BeginArray("errors");
+    for (auto index = 0U; index < pe->errList.GetErrorsCount(); index++)
+        output->AddString("", pe->errList.GetError(index));
+    output->EndArray();
+    output->BeginArray("warnings");
+    for (auto index = 0U; index < pe->errList.GetWarningsCount(); index++)
+        output->AddString("", pe->errList.GetWarning(index));
+    output->EndArray();
+
+    return true;
+}
+
 PLUGIN_EXPORT void UpdateSettings(IniSection sect)
 {
     sect["Pattern"]                  = "magic:4D 5A";
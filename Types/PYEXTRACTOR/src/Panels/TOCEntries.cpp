@@ -73,7 +73,7 @@ void TOCEntries::OpenCurrentEntry()
     fullPath.AddChar((char16_t) std::filesystem::path::preferred_separator);
     fullPath.Add(entry->name);
 
-    GView::App::OpenBuffer(BufferView{ bufferDecompressed }, entry->name, fullPath, GView::App::OpenMethod::BestMatch);
+    GView::App::OpenBuffer(std::move(bufferDecompressed), entry->name, fullPath, GView::App::OpenMethod::BestMatch);
 }
 
 void TOCEntries::Update()
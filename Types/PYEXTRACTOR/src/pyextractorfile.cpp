@@ -26,36 +26,26 @@ bool PYEXTRACTORFile::HasPanel(Panels::IDs id)
 
 bool PYEXTRACTORFile::SetCookiePosition()
 {
-    const auto buffer = obj->GetData().GetEntireFile();
-    if (buffer.IsValid()) {
-        const std::string_view view{ reinterpret_cast<char*>(const_cast<uint8*>(buffer.GetData())), buffer.GetLength() };
-        if (const auto index = view.find(PYINSTALLER_MAGIC, 0); index != std::string::npos) {
-            archive.cookiePosition = index;
-            return true;
-        }
-        return false;
-    }
-
-    const auto fileSize  = obj->GetData().GetSize();
-    const auto cacheSize = (uint64) obj->GetData().GetCacheSize();
-    uint64 sizeToRead    = cacheSize;
-    uint64 index         = 0;
-
-    do {
-        const auto buffer = obj->GetData().CopyToBuffer(index, sizeToRead);
-        CHECK(buffer.IsValid(), false, "");
-
-        const std::string_view view{ reinterpret_cast<char*>(const_cast<uint8*>(buffer.GetData())), buffer.GetLength() };
-        if (const auto index = view.find(PYINSTALLER_MAGIC, 0); index != std::string::npos) {
-            archive.cookiePosition = index;
-            return true;
-        }
-
-        index += sizeToRead;
-        sizeToRead = std::min(fileSize, cacheSize);
-    } while (index < fileSize);
-
-    return false;
+    // overlap chunks so that a magic crossing a chunk boundary is still found
+    const auto overlap = static_cast<uint32>(PYINSTALLER_MAGIC.size() - 1);
+    auto found         = false;
+
+    obj->GetData().ForEachChunk(
+          0,
+          obj->GetData().GetSize(),
+          0,
+          overlap,
+          [&](uint64 chunkOffset, BufferView buffer) {
+              const std::string_view view{ reinterpret_cast<const char*>(buffer.GetData()), buffer.GetLength() };
+              if (const auto index = view.find(PYINSTALLER_MAGIC, 0); index != std::string::npos) {
+                  archive.cookiePosition = chunkOffset + index;
+                  found                  = true;
+                  return false;
+              }
+              return true;
+          });
+
+    return found;
 }
 
 inline void tolower(std::string& s)
@@ -195,8 +185,8 @@ void PYEXTRACTORFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::Tre
     const auto offset = (uint64) data->entryPos;
     const auto length = (uint32) data->cmprsdDataSize;
     const auto name   = std::string_view{ reinterpret_cast<char*>(data->name.GetData()), data->name.GetLength() };
-    const auto buffer = obj->GetData().CopyToBuffer(offset, length);
+    auto buffer       = obj->GetData().CopyToBuffer(offset, length);
 
-    GView::App::OpenBuffer(buffer, name, name, GView::App::OpenMethod::BestMatch);
+    GView::App::OpenBuffer(std::move(buffer), name, name, GView::App::OpenMethod::BestMatch);
 }
 } // namespace GView::Type::PYEXTRACTOR
@@ -206,6 +206,43 @@ class PasswordDialog : public Window, public Handlers::OnButtonPressedInterface
     }
 };
 
+static bool GetDropPath(Object* obj, std::u8string_view name, std::u16string& path)
+{
+    path = obj->GetPath();
+    path.append(u".drop");
+    path.push_back((char16_t) std::filesystem::path::preferred_separator);
+
+    LocalUnicodeStringBuilder<1024> ub;
+    CHECK(ub.Set(name), false, "");
+
+    path.append(ub.ToStringView());
+
+    if (std::filesystem::path::preferred_separator == u'\\') // if on windows
+    {
+        std::replace(path.begin(), path.end(), u'/', u'\\');
+    }
+    return true;
+}
+
+static bool GetEntryDataOffset(GView::Utils::DataCache& cache, const GView::Decoding::ZIP::Entry& entry, uint64& offset)
+{
+    constexpr uint32 LOCAL_FILE_HEADER_SIGNATURE = 0x04034B50;
+    constexpr uint64 LOCAL_FILE_HEADER_SIZE      = 30; // name and extra field lengths are the last two fields
+
+    CHECK(entry.GetDiskNumber() == 0 && entry.GetDiskOffset() >= 0, false, "Multi disk archives are not supported !");
+    const auto headerOffset = (uint64) entry.GetDiskOffset();
+    uint32 signature        = 0;
+    uint16 nameLength       = 0;
+    uint16 extraFieldLength = 0;
+    CHECK(cache.Copy<uint32>(headerOffset, signature), false, "");
+    CHECK(signature == LOCAL_FILE_HEADER_SIGNATURE, false, "Invalid local file header signature: 0x%X", signature);
+    CHECK(cache.Copy<uint16>(headerOffset + LOCAL_FILE_HEADER_SIZE - 4, nameLength), false, "");
+    CHECK(cache.Copy<uint16>(headerOffset + LOCAL_FILE_HEADER_SIZE - 2, extraFieldLength), false, "");
+
+    offset = headerOffset + LOCAL_FILE_HEADER_SIZE + nameLength + extraFieldLength;
+    return true;
+}
+
 void ZIPFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewItem item)
 {
     CHECKRET(item.GetParent().GetHandle() != InvalidItemHandle, "");
@@ -230,6 +267,19 @@ void ZIPFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
         }
     }
 
+    // stored members are contiguous inside the archive => open them as a view over it (no decompression, no copy)
+    if ((entry.GetCompressionMethod() == 0) && (entry.IsEncrypted() == false) && (entry.GetType() == GView::Decoding::ZIP::EntryType::File) &&
+        (entry.GetCompressedSize() > 0)) {
+        uint64 dataOffset = 0;
+        if (GetEntryDataOffset(obj->GetData(), entry, dataOffset)) {
+            const auto name = entry.GetFilename();
+            std::u16string path;
+            CHECKRET(GetDropPath(obj, name, path), "");
+            GView::App::OpenRange(obj, dataOffset, (uint64) entry.GetCompressedSize(), name, path, GView::App::OpenMethod::BestMatch, "", parentWindow);
+            return;
+        }
+    }
+
     Buffer buffer{};
     bool decompressed{ false };
 
@@ -244,21 +294,10 @@ void ZIPFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
         }
 
         if (decompressed) {
-            std::u16string path{ obj->GetPath() };
-            path.append(u".drop");
-            path.push_back((char16_t) std::filesystem::path::preferred_separator);
-
-            LocalUnicodeStringBuilder<1024> ub;
             const auto name = entry.GetFilename();
-            CHECKRET(ub.Set(name), "");
-
-            path.append(ub.ToStringView());
-
-            if (std::filesystem::path::preferred_separator == u'\\') // if on windows
-            {
-                std::replace(path.begin(), path.end(), u'/', u'\\');
-            }
-            GView::App::OpenBuffer(buffer, name, path, GView::App::OpenMethod::BestMatch);
+            std::u16string path;
+            CHECKRET(GetDropPath(obj, name, path), "");
+            GView::App::OpenBuffer(std::move(buffer), name, path, GView::App::OpenMethod::BestMatch);
 
             return;
         }
@@ -288,7 +327,7 @@ void ZIPFile::OnOpenItem(std::u16string_view path, AppCUI::Controls::TreeViewIte
             }
 
             const auto name = entry.GetFilename();
-            GView::App::OpenBuffer(buffer, name, name, GView::App::OpenMethod::BestMatch, "", parentWindow);
+            GView::App::OpenBuffer(std::move(buffer), name, name, GView::App::OpenMethod::BestMatch, "", parentWindow);
             return;
         }
 
@@ -105,6 +105,34 @@ PLUGIN_EXPORT bool PopulateWindow(Reference<GView::View::WindowInterface> win)
     return true;
 }
 
+PLUGIN_EXPORT bool Analyze(Reference<GView::Object> obj, Reference<GView::Utils::JSONWriter> output)
+{
+    auto zip = obj->GetContentType<GView::Type::ZIP::ZIPFile>();
+    CHECK(zip->Update(), false, "");
+
+    const auto count = zip->info.GetCount();
+    output->AddNumber("count", count);
+    output->BeginArray("entries");
+    for (uint32 i = 0; i < count; i++) {
+        GView::Decoding::ZIP::Entry entry{ 0 };
+        CHECKBK(zip->info.GetEntry(i, entry), "");
+
+        const auto filename = entry.GetFilename();
+        output->BeginObject();
+        output->AddString("name", std::string_view{ reinterpret_cast<const char*>(filename.data()), filename.size() });
+        output->AddString("type", entry.GetTypeName());
+        output->AddString("compressionMethod", entry.GetCompressionMethodName());
+        output->AddSignedNumber("compressedSize", entry.GetCompressedSize());
+        output->AddSignedNumber("uncompressedSize", entry.GetUncompressedSize());
+        output->AddSignedNumber("offset", entry.GetDiskOffset());
+        output->AddBool("isEncrypted", entry.IsEncrypted());
+        output->EndObject();
+    }
+    output->EndArray();
+
+    return true;
+}
+
 PLUGIN_EXPORT void UpdateSettings(IniSection sect)
 {
     static const std::initializer_list<std::string> patterns = {